@@ -19,6 +19,9 @@
 
 namespace OHOS {
 namespace Location {
+// satellite id, constellation type and additional info as int64, the other four attributes as double
+const size_t SATELLITE_PARCEL_SIZE = 3 * sizeof(int64_t) + 4 * sizeof(double);
+
 SatelliteStatus::SatelliteStatus()
 {
     satellitesNumber_ = 0;
@@ -26,14 +29,12 @@ SatelliteStatus::SatelliteStatus()
 
 SatelliteStatus::SatelliteStatus(SatelliteStatus& satelliteStatus)
 {
-    satellitesNumber_ = satelliteStatus.GetSatellitesNumber();
-    satelliteIds_ = satelliteStatus.GetSatelliteIds();
-    carrierToNoiseDensitys_ = satelliteStatus.GetCarrierToNoiseDensitys();
-    altitudes_ = satelliteStatus.GetAltitudes();
-    azimuths_ = satelliteStatus.GetAzimuths();
-    carrierFrequencies_ = satelliteStatus.GetCarrierFrequencies();
-    constellationTypes_ = satelliteStatus.GetConstellationTypes();
-    additionalInfoList_ = satelliteStatus.GetSatelliteAdditionalInfoList();
+    std::unique_lock<std::mutex> lock(satelliteStatus.mutex_);
+    satellitesNumber_ = satelliteStatus.satellitesNumber_;
+    satellites_ = satelliteStatus.satellites_;
+    for (int i = 0; i < SATELLITE_ATTRIBUTE_NUM; i++) {
+        attributeSizes_[i] = satelliteStatus.attributeSizes_[i];
+    }
 }
 
 void SatelliteStatus::ReadFromParcel(Parcel& parcel)
@@ -41,14 +42,17 @@ void SatelliteStatus::ReadFromParcel(Parcel& parcel)
     std::unique_lock<std::mutex> lock(mutex_);
     satellitesNumber_ = static_cast<unsigned int>(parcel.ReadInt64());
     satellitesNumber_ = satellitesNumber_ > MAXIMUM_INTERATION ? MAXIMUM_INTERATION : satellitesNumber_;
+    satellites_.reserve(satellites_.size() + satellitesNumber_);
     for (unsigned int i = 0; i < satellitesNumber_; i++) {
-        satelliteIds_.push_back(parcel.ReadInt64());
-        carrierToNoiseDensitys_.push_back(parcel.ReadDouble());
-        altitudes_.push_back(parcel.ReadDouble());
-        azimuths_.push_back(parcel.ReadDouble());
-        carrierFrequencies_.push_back(parcel.ReadDouble());
-        constellationTypes_.push_back(parcel.ReadInt64());
-        additionalInfoList_.push_back(parcel.ReadInt64());
+        SatelliteInfo satellite;
+        satellite.satelliteId = parcel.ReadInt64();
+        satellite.carrierToNoiseDensity = parcel.ReadDouble();
+        satellite.altitude = parcel.ReadDouble();
+        satellite.azimuth = parcel.ReadDouble();
+        satellite.carrierFrequency = parcel.ReadDouble();
+        satellite.constellationType = parcel.ReadInt64();
+        satellite.additionalInfo = parcel.ReadInt64();
+        AppendSatellite(satellite);
     }
 }
 
@@ -58,48 +62,36 @@ bool SatelliteStatus::Marshalling(Parcel& parcel) const
     if (!isValid) {
         return false;
     }
+    // grow the parcel once for all satellites instead of once per written field
+    size_t dataSize = parcel.GetDataSize() + sizeof(int64_t) + satellitesNumber_ * SATELLITE_PARCEL_SIZE;
+    if (parcel.GetDataCapacity() < dataSize) {
+        parcel.SetDataCapacity(dataSize);
+    }
     CHK_PARCEL_RETURN_VALUE(parcel.WriteInt64(satellitesNumber_));
     for (unsigned int i = 0; i < satellitesNumber_; i++) {
-        CHK_PARCEL_RETURN_VALUE(parcel.WriteInt64(satelliteIds_[i]));
-        CHK_PARCEL_RETURN_VALUE(parcel.WriteDouble(carrierToNoiseDensitys_[i]));
-        CHK_PARCEL_RETURN_VALUE(parcel.WriteDouble(altitudes_[i]));
-        CHK_PARCEL_RETURN_VALUE(parcel.WriteDouble(azimuths_[i]));
-        CHK_PARCEL_RETURN_VALUE(parcel.WriteDouble(carrierFrequencies_[i]));
-        CHK_PARCEL_RETURN_VALUE(parcel.WriteInt64(constellationTypes_[i]));
-        CHK_PARCEL_RETURN_VALUE(parcel.WriteInt64(additionalInfoList_[i]));
+        const SatelliteInfo& satellite = satellites_[i];
+        CHK_PARCEL_RETURN_VALUE(parcel.WriteInt64(satellite.satelliteId));
+        CHK_PARCEL_RETURN_VALUE(parcel.WriteDouble(satellite.carrierToNoiseDensity));
+        CHK_PARCEL_RETURN_VALUE(parcel.WriteDouble(satellite.altitude));
+        CHK_PARCEL_RETURN_VALUE(parcel.WriteDouble(satellite.azimuth));
+        CHK_PARCEL_RETURN_VALUE(parcel.WriteDouble(satellite.carrierFrequency));
+        CHK_PARCEL_RETURN_VALUE(parcel.WriteInt64(satellite.constellationType));
+        CHK_PARCEL_RETURN_VALUE(parcel.WriteInt64(satellite.additionalInfo));
     }
     return true;
 }
 
 bool SatelliteStatus::IsValidityDatas() const
 {
-    if (satellitesNumber_ != satelliteIds_.size()) {
-        LBSLOGE(GNSS, "%{public}s: satelliteIds data length is incorrect.", __func__);
-        return false;
-    }
-    if (satellitesNumber_ != carrierToNoiseDensitys_.size()) {
-        LBSLOGE(GNSS, "%{public}s: carrierToNoiseDensitys data length is incorrect.", __func__);
-        return false;
-    }
-    if (satellitesNumber_ != altitudes_.size()) {
-        LBSLOGE(GNSS, "%{public}s: altitudes data length is incorrect.", __func__);
-        return false;
-    }
-    if (satellitesNumber_ != azimuths_.size()) {
-        LBSLOGE(GNSS, "%{public}s: azimuths data length is incorrect.", __func__);
-        return false;
-    }
-    if (satellitesNumber_ != carrierFrequencies_.size()) {
-        LBSLOGE(GNSS, "%{public}s: carrierFrequencies data length is incorrect.", __func__);
-        return false;
-    }
-    if (satellitesNumber_ != constellationTypes_.size()) {
-        LBSLOGE(GNSS, "%{public}s: constellationTypes data length is incorrect.", __func__);
-        return false;
-    }
-    if (satellitesNumber_ != additionalInfoList_.size()) {
-        LBSLOGE(GNSS, "%{public}s: additionalInfoList data length is incorrect.", __func__);
-        return false;
+    static const char* attributeNames[SATELLITE_ATTRIBUTE_NUM] = {
+        "satelliteIds", "carrierToNoiseDensitys", "altitudes", "azimuths",
+        "carrierFrequencies", "constellationTypes", "additionalInfoList",
+    };
+    for (int i = 0; i < SATELLITE_ATTRIBUTE_NUM; i++) {
+        if (satellitesNumber_ != attributeSizes_[i]) {
+            LBSLOGE(GNSS, "%{public}s: %{public}s data length is incorrect.", __func__, attributeNames[i]);
+            return false;
+        }
     }
     return true;
 }
@@ -60,24 +60,23 @@ void SatelliteStatusToJs(const napi_env& env,
         NAPI_CALL_RETURN_VOID(env, napi_create_array_with_length(env, svNum, &satelliteConstellationArray));
         NAPI_CALL_RETURN_VOID(env, napi_create_array_with_length(env, svNum, &additionalInfoArray));
         uint32_t idx1 = 0;
-        for (int index = 0; index < svNum; index++) {
+        const std::vector<SatelliteInfo>& satellites = statusInfo->GetSatellites();
+        for (int index = 0; index < svNum && index < static_cast<int>(satellites.size()); index++) {
+            const SatelliteInfo& satellite = satellites[index];
             napi_value value = nullptr;
-            NAPI_CALL_RETURN_VOID(env, napi_create_int32(env, statusInfo->GetSatelliteIds()[index], &value));
+            NAPI_CALL_RETURN_VOID(env, napi_create_int32(env, satellite.satelliteId, &value));
             NAPI_CALL_RETURN_VOID(env, napi_set_element(env, satelliteIdsArray, idx1, value));
-            NAPI_CALL_RETURN_VOID(env,
-                napi_create_double(env, statusInfo->GetCarrierToNoiseDensitys()[index], &value));
+            NAPI_CALL_RETURN_VOID(env, napi_create_double(env, satellite.carrierToNoiseDensity, &value));
             NAPI_CALL_RETURN_VOID(env, napi_set_element(env, cn0Array, idx1, value));
-            NAPI_CALL_RETURN_VOID(env, napi_create_double(env, statusInfo->GetAltitudes()[index], &value));
+            NAPI_CALL_RETURN_VOID(env, napi_create_double(env, satellite.altitude, &value));
             NAPI_CALL_RETURN_VOID(env, napi_set_element(env, altitudesArray, idx1, value));
-            NAPI_CALL_RETURN_VOID(env, napi_create_double(env, statusInfo->GetAzimuths()[index], &value));
+            NAPI_CALL_RETURN_VOID(env, napi_create_double(env, satellite.azimuth, &value));
             NAPI_CALL_RETURN_VOID(env, napi_set_element(env, azimuthsArray, idx1, value));
-            NAPI_CALL_RETURN_VOID(env, napi_create_double(env, statusInfo->GetCarrierFrequencies()[index], &value));
+            NAPI_CALL_RETURN_VOID(env, napi_create_double(env, satellite.carrierFrequency, &value));
             NAPI_CALL_RETURN_VOID(env, napi_set_element(env, carrierFrequenciesArray, idx1, value));
-            NAPI_CALL_RETURN_VOID(env,
-                napi_create_int32(env, statusInfo->GetSatelliteAdditionalInfoList()[index], &value));
+            NAPI_CALL_RETURN_VOID(env, napi_create_int32(env, satellite.additionalInfo, &value));
             NAPI_CALL_RETURN_VOID(env, napi_set_element(env, additionalInfoArray, idx1, value));
-            NAPI_CALL_RETURN_VOID(env,
-                napi_create_int32(env, statusInfo->GetConstellationTypes()[index], &value));
+            NAPI_CALL_RETURN_VOID(env, napi_create_int32(env, satellite.constellationType, &value));
             NAPI_CALL_RETURN_VOID(env, napi_set_element(env, satelliteConstellationArray, idx1, value));
             idx1++;
         }
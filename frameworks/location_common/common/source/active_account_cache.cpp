@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "active_account_cache.h"
+
+#include "location_log.h"
+
+namespace OHOS {
+namespace Location {
+static constexpr int MAX_READ_RETRY_TIMES = 3;
+
+ActiveAccountCache* ActiveAccountCache::GetInstance()
+{
+    static ActiveAccountCache data;
+    return &data;
+}
+
+ActiveAccountCache::ActiveAccountCache()
+{
+    sequence_.store(0);
+    isEventDriven_.store(false);
+    count_.store(0);
+    for (int i = 0; i < MAX_CACHED_ACTIVE_USER_NUM; i++) {
+        ids_[i].store(0);
+    }
+    avoidedIpcCount_.store(0);
+    queriedIpcCount_.store(0);
+}
+
+bool ActiveAccountCache::GetActiveUserIds(std::vector<int>& activeIds)
+{
+    if (!isEventDriven_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    int32_t ids[MAX_CACHED_ACTIVE_USER_NUM];
+    for (int retry = 0; retry < MAX_READ_RETRY_TIMES; retry++) {
+        uint64_t begin = sequence_.load(std::memory_order_acquire);
+        if ((begin & 1) != 0) {
+            // a writer is publishing, try again
+            continue;
+        }
+        int32_t count = count_.load(std::memory_order_relaxed);
+        if (count <= 0 || count > MAX_CACHED_ACTIVE_USER_NUM) {
+            return false;
+        }
+        for (int32_t i = 0; i < count; i++) {
+            ids[i] = ids_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) == begin) {
+            activeIds.assign(ids, ids + count);
+            avoidedIpcCount_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t ActiveAccountCache::GetGeneration()
+{
+    return sequence_.load(std::memory_order_acquire);
+}
+
+void ActiveAccountCache::UpdateActiveUserIds(const std::vector<int>& activeIds, uint64_t generation)
+{
+    if (!isEventDriven_.load(std::memory_order_acquire) || activeIds.empty() ||
+        activeIds.size() > MAX_CACHED_ACTIVE_USER_NUM) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(writeMutex_);
+    // an account event arrived while the ids were queried, the result may already be stale
+    if (sequence_.load(std::memory_order_relaxed) != generation) {
+        return;
+    }
+    sequence_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < activeIds.size(); i++) {
+        ids_[i].store(activeIds[i], std::memory_order_relaxed);
+    }
+    count_.store(static_cast<int32_t>(activeIds.size()), std::memory_order_relaxed);
+    sequence_.fetch_add(1, std::memory_order_release);
+}
+
+void ActiveAccountCache::Invalidate()
+{
+    std::unique_lock<std::mutex> lock(writeMutex_);
+    sequence_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    count_.store(0, std::memory_order_relaxed);
+    sequence_.fetch_add(1, std::memory_order_release);
+}
+
+void ActiveAccountCache::SetEventDriven(bool isEventDriven)
+{
+    LBSLOGI(COMMON_UTILS, "active account cache event driven: %{public}d", isEventDriven);
+    isEventDriven_.store(isEventDriven, std::memory_order_release);
+    Invalidate();
+}
+
+uint64_t ActiveAccountCache::GetAvoidedIpcCount()
+{
+    return avoidedIpcCount_.load(std::memory_order_relaxed);
+}
+
+uint64_t ActiveAccountCache::GetQueriedIpcCount()
+{
+    return queriedIpcCount_.load(std::memory_order_relaxed);
+}
+
+void ActiveAccountCache::IncreaseQueriedIpcCount()
+{
+    queriedIpcCount_.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace Location
+} // namespace OHOS
@@ -22,6 +22,7 @@
 #include <fstream>
 
 #include "common_utils.h"
+#include "active_account_cache.h"
 #include "if_system_ability_manager.h"
 #include "iservice_registry.h"
 #include "system_ability_definition.h"
@@ -134,6 +135,12 @@ std::string CommonUtils::InitDeviceId()
 
 bool CommonUtils::GetActiveUserIds(std::vector<int>& activeIds)
 {
+    auto accountCache = ActiveAccountCache::GetInstance();
+    if (accountCache->GetActiveUserIds(activeIds)) {
+        return true;
+    }
+    uint64_t generation = accountCache->GetGeneration();
+    accountCache->IncreaseQueriedIpcCount();
     int ret = AccountSA::OsAccountManager::QueryActiveOsAccountIds(activeIds);
     if (ret != 0) {
         activeIds.push_back(DEFAULT_USERID);
@@ -145,6 +152,7 @@ bool CommonUtils::GetActiveUserIds(std::vector<int>& activeIds)
         LBSLOGE(COMMON_UTILS, "QueryActiveOsAccountIds activeIds empty");
         return false;
     }
+    accountCache->UpdateActiveUserIds(activeIds, generation);
     return true;
 }
 
@@ -162,15 +170,8 @@ int CommonUtils::GetUserIdByUid(int uid)
 bool CommonUtils::GetCurrentUserId(int &userId)
 {
     std::vector<int> activeIds;
-    int ret = AccountSA::OsAccountManager::QueryActiveOsAccountIds(activeIds);
-    if (ret != 0) {
-        userId = DEFAULT_USERID;
-        LBSLOGI(COMMON_UTILS, "GetCurrentUserId failed ret:%{public}d", ret);
-        return false;
-    }
-    if (activeIds.empty()) {
+    if (!GetActiveUserIds(activeIds)) {
         userId = DEFAULT_USERID;
-        LBSLOGE(COMMON_UTILS, "QueryActiveOsAccountIds activeIds empty");
         return false;
     }
     userId = activeIds[0];
@@ -66,6 +66,16 @@ LocationErrCode HookUtils::ExecuteHook(
     return ERRCODE_SERVICE_UNAVAILABLE;
 }
 
+bool HookUtils::HasHook(LocationProcessStage stage)
+{
+    // lets hot paths skip building the hook payload when nothing is registered for the stage
+    HOOK_MGR* hookMgr = GetLocationExtHookMgr();
+    if (hookMgr == nullptr) {
+        return false;
+    }
+    return HookMgrGetHooksCnt(hookMgr, static_cast<int>(stage)) > 0;
+}
+
 void HookUtils::ExecuteHookWhenStartLocation(std::shared_ptr<Request>& request)
 {
     LocationSupplicantInfo reportStruct;
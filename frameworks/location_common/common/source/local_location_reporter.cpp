@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "local_location_reporter.h"
+
+#include "constant_definition.h"
+#include "location_log.h"
+
+namespace OHOS {
+namespace Location {
+LocalLocationReporter* LocalLocationReporter::GetInstance()
+{
+    static LocalLocationReporter data;
+    return &data;
+}
+
+void LocalLocationReporter::RegisterReporter(const ReportFunc& reporter)
+{
+    std::unique_lock<std::mutex> lock(reporterMutex_);
+    reporter_ = std::make_shared<const ReportFunc>(reporter);
+}
+
+void LocalLocationReporter::UnregisterReporter()
+{
+    std::unique_lock<std::mutex> lock(reporterMutex_);
+    reporter_ = nullptr;
+}
+
+bool LocalLocationReporter::IsRegistered()
+{
+    std::unique_lock<std::mutex> lock(reporterMutex_);
+    return reporter_ != nullptr;
+}
+
+bool LocalLocationReporter::ReportLocation(const std::string& abilityName, const std::shared_ptr<Location>& location)
+{
+    std::shared_ptr<const ReportFunc> reporter;
+    {
+        std::unique_lock<std::mutex> lock(reporterMutex_);
+        reporter = reporter_;
+    }
+    if (reporter == nullptr || location == nullptr) {
+        return false;
+    }
+    int errCode = (*reporter)(abilityName, location);
+    if (errCode != ERRCODE_SUCCESS) {
+        LBSLOGE(COMMON_UTILS, "%{public}s: report %{public}s location failed, errCode = %{public}d",
+            __func__, abilityName.c_str(), errCode);
+    }
+    return true;
+}
+} // namespace Location
+} // namespace OHOS
@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "active_account_cache.h"
 #include "location_log.h"
 
 namespace OHOS {
@@ -35,6 +36,16 @@ void LocationDumper::PrintArgs(const std::vector<std::string>& vecArgs)
     LBSLOGI(COMMON_UTILS, "Dumper[%{public}zu] args: %{public}s", vecArgs.size(), strArgs.c_str());
 }
 
+void LocationDumper::AppendAccountCacheInfo(std::string& result)
+{
+    auto accountCache = ActiveAccountCache::GetInstance();
+    result.append("Account query IPC avoided: ")
+        .append(std::to_string(accountCache->GetAvoidedIpcCount()))
+        .append(", performed: ")
+        .append(std::to_string(accountCache->GetQueriedIpcCount()))
+        .append("\n");
+}
+
 bool LocationDumper::GeocodeDump(std::function<void(std::string&)> saBasicDumpFunc,
     const std::vector<std::string>& vecArgs, std::string& result)
 {
@@ -49,6 +60,7 @@ bool LocationDumper::GeocodeDump(std::function<void(std::string&)> saBasicDumpFu
     }
 
     saBasicDumpFunc(result);
+    AppendAccountCacheInfo(result);
     return true;
 }
 
@@ -66,6 +78,7 @@ bool LocationDumper::GnssDump(std::function<void(std::string&)> saBasicDumpFunc,
     }
 
     saBasicDumpFunc(result);
+    AppendAccountCacheInfo(result);
     return true;
 }
 
@@ -83,6 +96,7 @@ bool LocationDumper::LocatorDump(std::function<void(std::string&)> saBasicDumpFu
     }
 
     saBasicDumpFunc(result);
+    AppendAccountCacheInfo(result);
     return true;
 }
 
@@ -100,6 +114,7 @@ bool LocationDumper::NetWorkDump(std::function<void(std::string&)> saBasicDumpFu
     }
 
     saBasicDumpFunc(result);
+    AppendAccountCacheInfo(result);
     return true;
 }
 
@@ -117,6 +132,7 @@ bool LocationDumper::PassiveDump(std::function<void(std::string&)> saBasicDumpFu
     }
 
     saBasicDumpFunc(result);
+    AppendAccountCacheInfo(result);
     return true;
 }
 }  // namespace Location
@@ -15,6 +15,8 @@
 
 #include "permission_manager.h"
 
+#include <atomic>
+
 #include "accesstoken_kit.h"
 #include "iservice_registry.h"
 #include "os_account_manager.h"
@@ -24,6 +26,9 @@
 
 namespace OHOS {
 namespace Location {
+// changes whenever a watched permission state changes, lets callers cache permission checks
+static std::atomic<uint64_t> g_permissionGeneration(0);
+
 bool PermissionManager::CheckLocationPermission(uint32_t tokenId, uint32_t firstTokenId)
 {
     return CheckPermission(ACCESS_LOCATION, tokenId, firstTokenId);
@@ -140,5 +145,15 @@ bool PermissionManager::CheckLocationSwitchIgnoredPermission(uint32_t tokenId, u
 {
     return CheckPermission(ACCESS_LOCATION_SWITCH_IGNORED, tokenId, firstTokenId);
 }
+
+uint64_t PermissionManager::GetPermissionGeneration()
+{
+    return g_permissionGeneration.load();
+}
+
+void PermissionManager::InvalidatePermissionState()
+{
+    g_permissionGeneration.fetch_add(1);
+}
 } // namespace Location
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -49,12 +49,14 @@ void ProxyFreezeManager::ProxyForFreeze(const std::vector<int32_t>& pidList, boo
                 *it, isProxy, std::to_string(CommonUtils::GetCurrentTimeMilSec()).c_str());
         }
     }
+    proxyGeneration_.fetch_add(1);
 }
 
 void ProxyFreezeManager::ResetAllProxy()
 {
     std::unique_lock<std::mutex> lock(proxyPidsMutex_);
     proxyPids_.clear();
+    proxyGeneration_.fetch_add(1);
 }
 
 bool ProxyFreezeManager::IsProxyPid(int32_t pid)
@@ -62,5 +64,10 @@ bool ProxyFreezeManager::IsProxyPid(int32_t pid)
     std::unique_lock<std::mutex> lock(proxyPidsMutex_);
     return proxyPids_.find(pid) != proxyPids_.end();
 }
+
+uint64_t ProxyFreezeManager::GetProxyGeneration()
+{
+    return proxyGeneration_.load();
+}
 } // namespace Location
 } // namespace OHOS
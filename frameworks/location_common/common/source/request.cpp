@@ -40,6 +40,7 @@ Request::Request()
     locationSrcStaticMap_[NETWORK_TYPE] = 0;
     locationSrcStaticMap_[INDOOR_TYPE] = 0;
     locationSrcStaticMap_[RTK_TYPE] = 0;
+    ClearAuthSnapshot();
 }
 
 Request::Request(std::unique_ptr<RequestConfig>& requestConfig,
@@ -63,6 +64,7 @@ Request::Request(std::unique_ptr<RequestConfig>& requestConfig,
     locationSrcStaticMap_[NETWORK_TYPE] = 0;
     locationSrcStaticMap_[INDOOR_TYPE] = 0;
     locationSrcStaticMap_[RTK_TYPE] = 0;
+    ClearAuthSnapshot();
     SetUid(identity.GetUid());
     SetPid(identity.GetPid());
     SetTokenId(identity.GetTokenId());
@@ -85,6 +87,8 @@ void Request::SetRequestConfig(RequestConfig& requestConfig)
         return;
     }
     requestConfig_->Set(requestConfig);
+    // fix number decides whether background state matters, so the snapshot must be rebuilt
+    ClearAuthSnapshot();
 }
 
 void Request::SetLocatorCallBack(const sptr<ILocatorCallback>& callback)
@@ -502,5 +506,29 @@ void Request::ClearAllCategoryCounts()
     locationSrcStaticMap_[RTK_TYPE] = 0;
     return;
 }
+
+void Request::SetAuthSnapshot(uint64_t generation, int permissionLevel, bool isSystemApp)
+{
+    authSnapshotPermissionLevel_ = permissionLevel;
+    authSnapshotIsSystemApp_ = isSystemApp;
+    authSnapshotGeneration_ = generation;
+}
+
+bool Request::GetAuthSnapshot(uint64_t generation, int& permissionLevel, bool& isSystemApp)
+{
+    if (authSnapshotGeneration_ == 0 || authSnapshotGeneration_ != generation) {
+        return false;
+    }
+    permissionLevel = authSnapshotPermissionLevel_;
+    isSystemApp = authSnapshotIsSystemApp_;
+    return true;
+}
+
+void Request::ClearAuthSnapshot()
+{
+    authSnapshotGeneration_ = 0;
+    authSnapshotPermissionLevel_ = 0;
+    authSnapshotIsSystemApp_ = false;
+}
 } // namespace Location
 } // namespace OHOS
\ No newline at end of file
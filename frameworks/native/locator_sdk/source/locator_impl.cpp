@@ -46,8 +46,9 @@ std::mutex g_nmeaCallbacksMutex;
 std::shared_ptr<CallbackResumeManager> g_callbackResumer = std::make_shared<CallbackResumeManager>();
 using CallbackResumeHandle = std::function<void()>;
 std::map<sptr<ILocatorCallback>, RequestConfig> g_locationCallbackMap;
-std::set<sptr<IRemoteObject>> g_gnssStatusInfoCallbacks;
-std::set<sptr<IRemoteObject>> g_nmeaCallbacks;
+// callback -> minimum report interval in ms
+std::map<sptr<IRemoteObject>, int> g_gnssStatusInfoCallbacks;
+std::map<sptr<IRemoteObject>, int> g_nmeaCallbacks;
 
 std::shared_ptr<LocatorImpl> LocatorImpl::GetInstance()
 {
@@ -225,7 +226,7 @@ bool LocatorImpl::RegisterGnssStatusCallback(const sptr<IRemoteObject>& callback
         LBSLOGE(LOCATOR_STANDARD, "%{public}s callback has registered.", __func__);
         return false;
     }
-    AddSatelliteStatusChangeCallBack(callback);
+    AddSatelliteStatusChangeCallBack(callback, 0);
     proxy->RegisterGnssStatusCallback(callback);
     return true;
 }
@@ -266,7 +267,7 @@ bool LocatorImpl::RegisterNmeaMessageCallback(const sptr<IRemoteObject>& callbac
         LBSLOGE(LOCATOR_STANDARD, "%{public}s callback has registered.", __func__);
         return false;
     }
-    AddNmeaCallBack(callback);
+    AddNmeaCallBack(callback, 0);
     proxy->RegisterNmeaMessageCallback(callback);
     return true;
 }
@@ -832,6 +833,15 @@ LocationErrCode LocatorImpl::UnregisterSwitchCallbackV9(const sptr<IRemoteObject
 
 LocationErrCode LocatorImpl::RegisterGnssStatusCallbackV9(const sptr<IRemoteObject>& callback)
 {
+    return RegisterGnssStatusCallbackV9(callback, 0);
+}
+
+LocationErrCode LocatorImpl::RegisterGnssStatusCallbackV9(const sptr<IRemoteObject>& callback, int minIntervalMs)
+{
+    if (minIntervalMs < 0) {
+        LBSLOGE(LOCATOR_STANDARD, "%{public}s invalid interval %{public}d", __func__, minIntervalMs);
+        return ERRCODE_INVALID_PARAM;
+    }
     if (!SaLoadWithStatistic::InitLocationSa(LOCATION_LOCATOR_SA_ID)) {
         return ERRCODE_SERVICE_UNAVAILABLE;
     }
@@ -848,8 +858,10 @@ LocationErrCode LocatorImpl::RegisterGnssStatusCallbackV9(const sptr<IRemoteObje
         LBSLOGE(LOCATOR_STANDARD, "%{public}s callback has registered.", __func__);
         return ERRCODE_SERVICE_UNAVAILABLE;
     }
-    AddSatelliteStatusChangeCallBack(callback);
-    ErrCode errorCodeValue = proxy->RegisterGnssStatusCallback(callback);
+    AddSatelliteStatusChangeCallBack(callback, minIntervalMs);
+    ErrCode errorCodeValue = minIntervalMs > 0 ?
+        proxy->RegisterGnssStatusCallbackWithInterval(callback, minIntervalMs) :
+        proxy->RegisterGnssStatusCallback(callback);
     LocationErrCode locationErrCode = CommonUtils::ErrCodeToLocationErrCode(errorCodeValue);
     if (locationErrCode != ERRCODE_SUCCESS) {
         RemoveSatelliteStatusChangeCallBack(callback);
@@ -880,6 +892,15 @@ LocationErrCode LocatorImpl::UnregisterGnssStatusCallbackV9(const sptr<IRemoteOb
 
 LocationErrCode LocatorImpl::RegisterNmeaMessageCallbackV9(const sptr<IRemoteObject>& callback)
 {
+    return RegisterNmeaMessageCallbackV9(callback, 0);
+}
+
+LocationErrCode LocatorImpl::RegisterNmeaMessageCallbackV9(const sptr<IRemoteObject>& callback, int minIntervalMs)
+{
+    if (minIntervalMs < 0) {
+        LBSLOGE(LOCATOR_STANDARD, "%{public}s invalid interval %{public}d", __func__, minIntervalMs);
+        return ERRCODE_INVALID_PARAM;
+    }
     if (!SaLoadWithStatistic::InitLocationSa(LOCATION_LOCATOR_SA_ID)) {
         return ERRCODE_SERVICE_UNAVAILABLE;
     }
@@ -896,8 +917,10 @@ LocationErrCode LocatorImpl::RegisterNmeaMessageCallbackV9(const sptr<IRemoteObj
         LBSLOGE(LOCATOR_STANDARD, "%{public}s callback has registered.", __func__);
         return ERRCODE_SERVICE_UNAVAILABLE;
     }
-    AddNmeaCallBack(callback);
-    ErrCode errorCodeValue = proxy->RegisterNmeaMessageCallback(callback);
+    AddNmeaCallBack(callback, minIntervalMs);
+    ErrCode errorCodeValue = minIntervalMs > 0 ?
+        proxy->RegisterNmeaMessageCallbackWithInterval(callback, minIntervalMs) :
+        proxy->RegisterNmeaMessageCallback(callback);
     LocationErrCode locationErrCode = CommonUtils::ErrCodeToLocationErrCode(errorCodeValue);
     if (locationErrCode != ERRCODE_SUCCESS) {
         RemoveNmeaCallBack(callback);
@@ -1764,12 +1787,7 @@ bool LocatorImpl::IsSatelliteStatusChangeCallbackRegistered(const sptr<IRemoteOb
         return true;
     }
     std::unique_lock<std::mutex> lock(g_gnssStatusInfoCallbacksMutex);
-    for (auto gnssStatusCallback : g_gnssStatusInfoCallbacks) {
-        if (gnssStatusCallback == callback) {
-            return true;
-        }
-    }
-    return false;
+    return g_gnssStatusInfoCallbacks.find(callback) != g_gnssStatusInfoCallbacks.end();
 }
 
 bool LocatorImpl::IsSatelliteStatusChangeCallbackTooMany()
@@ -1789,12 +1807,7 @@ bool LocatorImpl::IsNmeaCallbackRegistered(const sptr<IRemoteObject>& callback)
         return true;
     }
     std::unique_lock<std::mutex> lock(g_nmeaCallbacksMutex);
-    for (auto nmeaCallback : g_nmeaCallbacks) {
-        if (nmeaCallback == callback) {
-            return true;
-        }
-    }
-    return false;
+    return g_nmeaCallbacks.find(callback) != g_nmeaCallbacks.end();
 }
 
 bool LocatorImpl::IsNmeaCallbackTooMany()
@@ -1824,38 +1837,28 @@ void LocatorImpl::RemoveLocationCallBack(sptr<ILocatorCallback>& callback)
     }
 }
 
-void LocatorImpl::AddSatelliteStatusChangeCallBack(const sptr<IRemoteObject>& callback)
+void LocatorImpl::AddSatelliteStatusChangeCallBack(const sptr<IRemoteObject>& callback, int minIntervalMs)
 {
     std::unique_lock<std::mutex> lock(g_gnssStatusInfoCallbacksMutex);
-    g_gnssStatusInfoCallbacks.insert(callback);
+    g_gnssStatusInfoCallbacks.insert(std::make_pair(callback, minIntervalMs));
 }
 
 void LocatorImpl::RemoveSatelliteStatusChangeCallBack(const sptr<IRemoteObject>& callback)
 {
     std::unique_lock<std::mutex> lock(g_gnssStatusInfoCallbacksMutex);
-    for (auto iter = g_gnssStatusInfoCallbacks.begin(); iter != g_gnssStatusInfoCallbacks.end(); iter++) {
-        if (callback == *iter) {
-            g_gnssStatusInfoCallbacks.erase(callback);
-            break;
-        }
-    }
+    g_gnssStatusInfoCallbacks.erase(callback);
 }
 
-void LocatorImpl::AddNmeaCallBack(const sptr<IRemoteObject>& callback)
+void LocatorImpl::AddNmeaCallBack(const sptr<IRemoteObject>& callback, int minIntervalMs)
 {
     std::unique_lock<std::mutex> lock(g_nmeaCallbacksMutex);
-    g_nmeaCallbacks.insert(callback);
+    g_nmeaCallbacks.insert(std::make_pair(callback, minIntervalMs));
 }
 
 void LocatorImpl::RemoveNmeaCallBack(const sptr<IRemoteObject>& callback)
 {
     std::unique_lock<std::mutex> lock(g_nmeaCallbacksMutex);
-    for (auto iter = g_nmeaCallbacks.begin(); iter != g_nmeaCallbacks.end(); iter++) {
-        if (callback == *iter) {
-            g_nmeaCallbacks.erase(callback);
-            break;
-        }
-    }
+    g_nmeaCallbacks.erase(callback);
 }
 
 bool LocatorImpl::HasGnssNetworkRequest()
@@ -1989,11 +1992,15 @@ void CallbackResumeManager::ResumeGnssStatusCallback()
         return ;
     }
     std::unique_lock<std::mutex> lock(g_gnssStatusInfoCallbacksMutex);
-    for (auto gnssStatusCallback : g_gnssStatusInfoCallbacks) {
-        if (gnssStatusCallback == nullptr) {
+    for (auto& pair : g_gnssStatusInfoCallbacks) {
+        if (pair.first == nullptr) {
             continue;
         }
-        proxy->RegisterGnssStatusCallback(gnssStatusCallback);
+        if (pair.second > 0) {
+            proxy->RegisterGnssStatusCallbackWithInterval(pair.first, pair.second);
+        } else {
+            proxy->RegisterGnssStatusCallback(pair.first);
+        }
     }
 }
 
@@ -2005,11 +2012,15 @@ void CallbackResumeManager::ResumeNmeaMessageCallback()
         return;
     }
     std::unique_lock<std::mutex> lock(g_nmeaCallbacksMutex);
-    for (auto nmeaCallback : g_nmeaCallbacks) {
-        if (nmeaCallback == nullptr) {
+    for (auto& pair : g_nmeaCallbacks) {
+        if (pair.first == nullptr) {
             continue;
         }
-        proxy->RegisterNmeaMessageCallback(nmeaCallback);
+        if (pair.second > 0) {
+            proxy->RegisterNmeaMessageCallbackWithInterval(pair.first, pair.second);
+        } else {
+            proxy->RegisterNmeaMessageCallback(pair.first);
+        }
     }
 }
 
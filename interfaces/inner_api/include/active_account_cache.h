@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACTIVE_ACCOUNT_CACHE_H
+#define ACTIVE_ACCOUNT_CACHE_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace OHOS {
+namespace Location {
+static constexpr int MAX_CACHED_ACTIVE_USER_NUM = 8;
+
+/**
+ * Process-wide copy of the active os account ids.
+ * The cache only serves reads while an owner keeps it fresh from user
+ * switched/removed/started/stopped common events, see SetEventDriven.
+ * Readers never take a lock, a sequence counter detects concurrent updates.
+ */
+class ActiveAccountCache {
+public:
+    static ActiveAccountCache* GetInstance();
+    bool GetActiveUserIds(std::vector<int>& activeIds);
+    uint64_t GetGeneration();
+    void UpdateActiveUserIds(const std::vector<int>& activeIds, uint64_t generation);
+    void Invalidate();
+    void SetEventDriven(bool isEventDriven);
+    uint64_t GetAvoidedIpcCount();
+    uint64_t GetQueriedIpcCount();
+    void IncreaseQueriedIpcCount();
+private:
+    ActiveAccountCache();
+    ~ActiveAccountCache() = default;
+
+    std::mutex writeMutex_;
+    std::atomic<uint64_t> sequence_;
+    std::atomic<bool> isEventDriven_;
+    std::atomic<int32_t> count_;
+    std::atomic<int32_t> ids_[MAX_CACHED_ACTIVE_USER_NUM];
+    std::atomic<uint64_t> avoidedIpcCount_;
+    std::atomic<uint64_t> queriedIpcCount_;
+};
+} // namespace Location
+} // namespace OHOS
+#endif // ACTIVE_ACCOUNT_CACHE_H
@@ -177,6 +177,7 @@ public:
     static void UnregisterHook(LocationProcessStage stage, OhosHook hook);
     static LocationErrCode ExecuteHook(LocationProcessStage stage, void *executionContext,
         const HOOK_EXEC_OPTIONS *options);
+    static bool HasHook(LocationProcessStage stage);
     static void ExecuteHookWhenStartLocation(std::shared_ptr<Request>& request);
     static void ExecuteHookWhenStopLocation(std::shared_ptr<Request> request);
     static void ExecuteHookWhenGetAddressFromLocation(std::string packageName);
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOCAL_LOCATION_REPORTER_H
+#define LOCAL_LOCATION_REPORTER_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "location.h"
+
+namespace OHOS {
+namespace Location {
+/*
+ * Hands the locations of the sub abilities to the locator when both live in the same process.
+ * The locator registers itself on start, a sub ability falls back to ipc when nothing is registered.
+ */
+class LocalLocationReporter {
+public:
+    using ReportFunc = std::function<int(const std::string& abilityName, const std::shared_ptr<Location>& location)>;
+    static LocalLocationReporter* GetInstance();
+    void RegisterReporter(const ReportFunc& reporter);
+    void UnregisterReporter();
+    bool IsRegistered();
+    bool ReportLocation(const std::string& abilityName, const std::shared_ptr<Location>& location);
+private:
+    std::mutex reporterMutex_;
+    std::shared_ptr<const ReportFunc> reporter_;
+};
+} // namespace Location
+} // namespace OHOS
+#endif // LOCAL_LOCATION_REPORTER_H
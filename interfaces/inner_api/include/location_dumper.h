@@ -40,6 +40,7 @@ public:
         const std::vector<std::string> &vecArgs, std::string &result);
 private:
     void PrintArgs(const std::vector<std::string>& vecArgs);
+    void AppendAccountCacheInfo(std::string& result);
 };
 }  // namespace Location
 }  // namespace OHOS
@@ -53,7 +53,9 @@ enum {
     IDENTIFY_LEAVE_CAR_FAILED,
     GET_ON_CAR,
     START_GNSS_CACHE,
-    STOP_GNSS_CACHE
+    STOP_GNSS_CACHE,
+    RECEIVE_GNSS_LOCATION_SUMMARY,
+    RECEIVE_SATELLITESTATUSINFO_SUMMARY
 };
 
 constexpr size_t LBS_REQUEST_MAX_SIZE = 20;
@@ -389,6 +389,15 @@ public:
      */
     LocationErrCode RegisterGnssStatusCallbackV9(const sptr<IRemoteObject>& callback);
 
+    /**
+     * @brief Subscribe satellite status changed, reported at most once per interval.
+     *
+     * @param callback Indicates the callback for reporting the satellite status.
+     * @param minIntervalMs Indicates the minimum interval between two reports, 0 reports every change.
+     * @return Return ERRCODE_SUCCESS if the registration is successful.
+     */
+    LocationErrCode RegisterGnssStatusCallbackV9(const sptr<IRemoteObject>& callback, int minIntervalMs);
+
     /**
      * @brief Unsubscribe satellite status changed.
      *
@@ -405,6 +414,15 @@ public:
      */
     LocationErrCode RegisterNmeaMessageCallbackV9(const sptr<IRemoteObject>& callback);
 
+    /**
+     * @brief Subscribe nmea message changed, the sentences of one interval are reported together.
+     *
+     * @param callback Indicates the callback for reporting the nmea message.
+     * @param minIntervalMs Indicates the minimum interval between two reports, 0 reports every sentence.
+     * @return Return ERRCODE_SUCCESS if the registration is successful.
+     */
+    LocationErrCode RegisterNmeaMessageCallbackV9(const sptr<IRemoteObject>& callback, int minIntervalMs);
+
     /**
      * @brief Unsubscribe nmea message changed.
      *
@@ -759,9 +777,9 @@ public:
     bool HasGnssNetworkRequest();
     void AddLocationCallBack(std::unique_ptr<RequestConfig>& requestConfig, sptr<ILocatorCallback>& callback);
     void RemoveLocationCallBack(sptr<ILocatorCallback>& callback);
-    void AddSatelliteStatusChangeCallBack(const sptr<IRemoteObject>& callback);
+    void AddSatelliteStatusChangeCallBack(const sptr<IRemoteObject>& callback, int minIntervalMs);
     void RemoveSatelliteStatusChangeCallBack(const sptr<IRemoteObject>& callback);
-    void AddNmeaCallBack(const sptr<IRemoteObject>& callback);
+    void AddNmeaCallBack(const sptr<IRemoteObject>& callback, int minIntervalMs);
     void RemoveNmeaCallBack(const sptr<IRemoteObject>& callback);
     void SetIsServerExist(bool isServerExist);
     bool IsLocationRequestCountTooMany();
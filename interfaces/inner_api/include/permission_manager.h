@@ -49,6 +49,8 @@ public:
     static int GetPermissionLevel(uint32_t tokenId, uint32_t firstTokenId);
     static bool CheckIsSystemSa(uint32_t tokenId);
     static bool CheckLocationSwitchIgnoredPermission(uint32_t tokenId, uint32_t firstTokenId);
+    static uint64_t GetPermissionGeneration();
+    static void InvalidatePermissionState();
 };
 } // namespace Location
 } // namespace OHOS
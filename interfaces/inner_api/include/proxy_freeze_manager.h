@@ -15,6 +15,7 @@
 #ifndef PROXY_FREEZE_MANAGER_H
 #define PROXY_FREEZE_MANAGER_H
 
+#include <atomic>
 #include <string>
 #include <mutex>
 #include <set>
@@ -31,9 +32,12 @@ public:
     void ProxyForFreeze(const std::vector<int32_t>& pidList, bool isProxy);
     void ResetAllProxy();
     bool IsProxyPid(int32_t pid);
+    uint64_t GetProxyGeneration();
 private:
     std::mutex proxyPidsMutex_;
     std::set<int32_t> proxyPids_;
+    // changes whenever the proxy pid set changes, lets callers cache IsProxyPid results
+    std::atomic<uint64_t> proxyGeneration_{0};
 };
 } // namespace Location
 } // namespace OHOS
@@ -78,6 +78,9 @@ public:
     int GetLocationSrcStaticMapCount(int locSrc);
     int GetAllCategoryCounts();
     void ClearAllCategoryCounts();
+    void SetAuthSnapshot(uint64_t generation, int permissionLevel, bool isSystemApp);
+    bool GetAuthSnapshot(uint64_t generation, int& permissionLevel, bool& isSystemApp);
+    void ClearAuthSnapshot();
 private:
     void GetProxyNameByPriority(std::shared_ptr<std::list<std::string>> proxys);
     void GetProxyNameByScenario(std::shared_ptr<std::list<std::string>> proxys);
@@ -102,6 +105,9 @@ private:
     int permUsedType_;
     sptr<IRemoteObject::DeathRecipient> locatorCallbackRecipient_;
     std::unordered_map<int, int> locationSrcStaticMap_;
+    uint64_t authSnapshotGeneration_;
+    int authSnapshotPermissionLevel_;
+    bool authSnapshotIsSystemApp_;
 };
 } // namespace Location
 } // namespace OHOS
@@ -22,6 +22,16 @@
 
 namespace OHOS {
 namespace Location {
+struct SatelliteInfo {
+    int satelliteId = 0;
+    double carrierToNoiseDensity = 0.0;
+    double altitude = 0.0;
+    double azimuth = 0.0;
+    double carrierFrequency = 0.0;
+    int constellationType = 0;
+    int additionalInfo = 0;
+};
+
 class SatelliteStatus : public Parcelable {
 public:
     SatelliteStatus();
@@ -38,130 +48,167 @@ public:
         satellitesNumber_ = num;
     }
 
+    /* satellites with all attributes, attributes set one by one are filled in order */
+    inline const std::vector<SatelliteInfo>& GetSatellites() const
+    {
+        return satellites_;
+    }
+
+    inline void AddSatellite(const SatelliteInfo& satellite)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        AppendSatellite(satellite);
+    }
+
+    inline void SetSatellites(const std::vector<SatelliteInfo>& satellites)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        satellites_.reserve(satellites_.size() + satellites.size());
+        for (auto it = satellites.begin(); it != satellites.end(); ++it) {
+            AppendSatellite(*it);
+        }
+    }
+
+    inline void ReserveSatellites(size_t num)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        satellites_.reserve(num);
+    }
+
     inline std::vector<int> GetSatelliteIds() const
     {
-        return satelliteIds_;
+        return GetAttributes<int>(SATELLITE_ID, &SatelliteInfo::satelliteId);
     }
 
     inline void SetSatelliteIds(std::vector<int> ids)
     {
         std::unique_lock<std::mutex> lock(mutex_);
         for (std::vector<int>::iterator it = ids.begin(); it != ids.end(); ++it) {
-            satelliteIds_.push_back(*it);
+            AppendAttribute(SATELLITE_ID, &SatelliteInfo::satelliteId, *it);
         }
     }
 
     inline void SetSatelliteId(int id)
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        satelliteIds_.push_back(id);
+        AppendAttribute(SATELLITE_ID, &SatelliteInfo::satelliteId, id);
     }
 
     inline std::vector<double> GetCarrierToNoiseDensitys() const
     {
-        return carrierToNoiseDensitys_;
+        return GetAttributes<double>(CARRIER_TO_NOISE_DENSITY, &SatelliteInfo::carrierToNoiseDensity);
     }
 
     inline void SetCarrierToNoiseDensitys(std::vector<double> cn0)
     {
         std::unique_lock<std::mutex> lock(mutex_);
         for (std::vector<double>::iterator it = cn0.begin(); it != cn0.end(); ++it) {
-            carrierToNoiseDensitys_.push_back(*it);
+            AppendAttribute(CARRIER_TO_NOISE_DENSITY, &SatelliteInfo::carrierToNoiseDensity, *it);
         }
     }
 
     inline void SetCarrierToNoiseDensity(double cn0)
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        carrierToNoiseDensitys_.push_back(cn0);
+        AppendAttribute(CARRIER_TO_NOISE_DENSITY, &SatelliteInfo::carrierToNoiseDensity, cn0);
     }
 
     inline std::vector<double> GetAltitudes() const
     {
-        return altitudes_;
+        return GetAttributes<double>(ALTITUDE, &SatelliteInfo::altitude);
     }
 
     inline void SetAltitudes(std::vector<double> altitudes)
     {
         std::unique_lock<std::mutex> lock(mutex_);
         for (std::vector<double>::iterator it = altitudes.begin(); it != altitudes.end(); ++it) {
-            altitudes_.push_back(*it);
+            AppendAttribute(ALTITUDE, &SatelliteInfo::altitude, *it);
         }
     }
 
     inline void SetAltitude(double altitude)
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        altitudes_.push_back(altitude);
+        AppendAttribute(ALTITUDE, &SatelliteInfo::altitude, altitude);
     }
 
     inline std::vector<double> GetAzimuths() const
     {
-        return azimuths_;
+        return GetAttributes<double>(AZIMUTH, &SatelliteInfo::azimuth);
     }
 
     inline void SetAzimuths(std::vector<double> azimuths)
     {
         std::unique_lock<std::mutex> lock(mutex_);
         for (std::vector<double>::iterator it = azimuths.begin(); it != azimuths.end(); ++it) {
-            azimuths_.push_back(*it);
+            AppendAttribute(AZIMUTH, &SatelliteInfo::azimuth, *it);
         }
     }
 
     inline void SetAzimuth(double azimuth)
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        azimuths_.push_back(azimuth);
+        AppendAttribute(AZIMUTH, &SatelliteInfo::azimuth, azimuth);
     }
 
     inline std::vector<double> GetCarrierFrequencies() const
     {
-        return carrierFrequencies_;
+        return GetAttributes<double>(CARRIER_FREQUENCY, &SatelliteInfo::carrierFrequency);
     }
 
     inline void SetCarrierFrequencies(std::vector<double> cfs)
     {
         std::unique_lock<std::mutex> lock(mutex_);
         for (std::vector<double>::iterator it = cfs.begin(); it != cfs.end(); ++it) {
-            carrierFrequencies_.push_back(*it);
+            AppendAttribute(CARRIER_FREQUENCY, &SatelliteInfo::carrierFrequency, *it);
         }
     }
 
     inline void SetCarrierFrequencie(double cf)
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        carrierFrequencies_.push_back(cf);
+        AppendAttribute(CARRIER_FREQUENCY, &SatelliteInfo::carrierFrequency, cf);
     }
 
     inline std::vector<int> GetConstellationTypes() const
     {
-        return constellationTypes_;
+        return GetAttributes<int>(CONSTELLATION_TYPE, &SatelliteInfo::constellationType);
+    }
+
+    inline int GetConstellationType(size_t index) const
+    {
+        return GetAttribute<int>(CONSTELLATION_TYPE, &SatelliteInfo::constellationType, index);
     }
 
     inline void SetConstellationTypes(std::vector<int> types)
     {
         std::unique_lock<std::mutex> lock(mutex_);
         for (std::vector<int>::iterator it = types.begin(); it != types.end(); ++it) {
-            constellationTypes_.push_back(*it);
+            AppendAttribute(CONSTELLATION_TYPE, &SatelliteInfo::constellationType, *it);
         }
     }
 
     inline void SetConstellationType(int type)
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        constellationTypes_.push_back(type);
+        AppendAttribute(CONSTELLATION_TYPE, &SatelliteInfo::constellationType, type);
     }
 
     inline std::vector<int> GetSatelliteAdditionalInfoList()
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        return additionalInfoList_;
+        return GetAttributes<int>(ADDITIONAL_INFO, &SatelliteInfo::additionalInfo);
+    }
+
+    inline int GetSatelliteAdditionalInfo(size_t index) const
+    {
+        return GetAttribute<int>(ADDITIONAL_INFO, &SatelliteInfo::additionalInfo, index);
     }
 
     inline void SetSatelliteAdditionalInfo(int additionalInfo)
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        additionalInfoList_.push_back(additionalInfo);
+        AppendAttribute(ADDITIONAL_INFO, &SatelliteInfo::additionalInfo, additionalInfo);
     }
 
     inline void SetSatelliteAdditionalInfoList(std::vector<int> additionalInfo)
@@ -169,7 +216,7 @@ public:
         std::unique_lock<std::mutex> lock(mutex_);
         for (std::vector<int>::iterator it = additionalInfo.begin();
             it != additionalInfo.end(); ++it) {
-            additionalInfoList_.push_back(*it);
+            AppendAttribute(ADDITIONAL_INFO, &SatelliteInfo::additionalInfo, *it);
         }
     }
 
@@ -177,16 +224,78 @@ public:
     bool Marshalling(Parcel& parcel) const override;
     static std::unique_ptr<SatelliteStatus> Unmarshalling(Parcel& parcel);
 private:
+    enum SatelliteAttribute {
+        SATELLITE_ID = 0,
+        CARRIER_TO_NOISE_DENSITY,
+        ALTITUDE,
+        AZIMUTH,
+        CARRIER_FREQUENCY,
+        CONSTELLATION_TYPE,
+        ADDITIONAL_INFO,
+        SATELLITE_ATTRIBUTE_NUM,
+    };
+
+    template<typename T>
+    inline std::vector<T> GetAttributes(SatelliteAttribute attribute, T SatelliteInfo::*field) const
+    {
+        std::vector<T> attributes;
+        size_t size = attributeSizes_[attribute];
+        attributes.reserve(size);
+        for (size_t i = 0; i < size; i++) {
+            attributes.push_back(satellites_[i].*field);
+        }
+        return attributes;
+    }
+
+    /* one attribute without building the whole list, an attribute not set yet reads as default */
+    template<typename T>
+    inline T GetAttribute(SatelliteAttribute attribute, T SatelliteInfo::*field, size_t index) const
+    {
+        if (index >= attributeSizes_[attribute]) {
+            return T();
+        }
+        return satellites_[index].*field;
+    }
+
+    template<typename T>
+    inline void AppendAttribute(SatelliteAttribute attribute, T SatelliteInfo::*field, T value)
+    {
+        size_t index = attributeSizes_[attribute]++;
+        if (index >= satellites_.size()) {
+            satellites_.emplace_back();
+        }
+        satellites_[index].*field = value;
+    }
+
+    inline void AppendSatellite(const SatelliteInfo& satellite)
+    {
+        bool isComplete = true;
+        for (int i = 0; i < SATELLITE_ATTRIBUTE_NUM; i++) {
+            isComplete = isComplete && attributeSizes_[i] == satellites_.size();
+        }
+        if (isComplete) {
+            satellites_.push_back(satellite);
+            for (int i = 0; i < SATELLITE_ATTRIBUTE_NUM; i++) {
+                attributeSizes_[i]++;
+            }
+            return;
+        }
+        // partially filled by the attribute setters, every attribute is appended after its own last value
+        AppendAttribute(SATELLITE_ID, &SatelliteInfo::satelliteId, satellite.satelliteId);
+        AppendAttribute(CARRIER_TO_NOISE_DENSITY, &SatelliteInfo::carrierToNoiseDensity,
+            satellite.carrierToNoiseDensity);
+        AppendAttribute(ALTITUDE, &SatelliteInfo::altitude, satellite.altitude);
+        AppendAttribute(AZIMUTH, &SatelliteInfo::azimuth, satellite.azimuth);
+        AppendAttribute(CARRIER_FREQUENCY, &SatelliteInfo::carrierFrequency, satellite.carrierFrequency);
+        AppendAttribute(CONSTELLATION_TYPE, &SatelliteInfo::constellationType, satellite.constellationType);
+        AppendAttribute(ADDITIONAL_INFO, &SatelliteInfo::additionalInfo, satellite.additionalInfo);
+    }
+
     bool IsValidityDatas() const;
-    
+
     unsigned int satellitesNumber_;
-    std::vector<int> satelliteIds_;
-    std::vector<double> carrierToNoiseDensitys_;
-    std::vector<double> altitudes_;
-    std::vector<double> azimuths_;
-    std::vector<double> carrierFrequencies_;
-    std::vector<int> constellationTypes_;
-    std::vector<int> additionalInfoList_;
+    std::vector<SatelliteInfo> satellites_;
+    size_t attributeSizes_[SATELLITE_ATTRIBUTE_NUM] = {0};
     std::mutex mutex_;
 };
 } // namespace Location
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GEO_ADDRESS_CACHE_H
+#define GEO_ADDRESS_CACHE_H
+#ifdef FEATURE_GEOCODE_SUPPORT
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "geo_address.h"
+
+namespace OHOS {
+namespace Location {
+struct GeoAddressCacheEntry;
+using GeoAddressCacheEntryList = std::list<std::shared_ptr<GeoAddressCacheEntry>>;
+
+struct GeoAddressCacheEntry {
+    std::string locale;
+    double latitude = 0.0;
+    double longitude = 0.0;
+    int64_t row = 0;
+    int64_t column = 0;
+    std::list<std::shared_ptr<GeoAddress>> addresses;
+    GeoAddressCacheEntryList::iterator cellIter;
+    GeoAddressCacheEntryList::iterator lruIter;
+};
+
+/*
+ * Reverse geocoding results bucketed by locale and a fixed grid of 0.001 degree cells. A lookup only
+ * measures the entries of the cells around the requested position, so the cache can hold thousands of
+ * positions. When full, the least recently used position is evicted. Not thread safe, the owner serializes
+ * the calls.
+ */
+class GeoAddressCache {
+public:
+    GeoAddressCache(size_t capacity, double validDistance);
+    ~GeoAddressCache() = default;
+    std::list<std::shared_ptr<GeoAddress>> Get(const std::string& locale, double latitude, double longitude,
+        int32_t maxItems);
+    void Put(const std::string& locale, double latitude, double longitude,
+        const std::list<std::shared_ptr<GeoAddress>>& addresses);
+    size_t Size() const;
+    size_t GetCapacity() const;
+    void Clear();
+    void DumpInfo(std::string& result) const;
+
+private:
+    using CellKey = std::tuple<std::string, int64_t, int64_t>;
+    int64_t GetRowIndex(double latitude) const;
+    int64_t GetColumnIndex(double longitude) const;
+    int64_t GetColumnSpan(double latitude) const;
+    std::shared_ptr<GeoAddressCacheEntry> FindNearestEntry(const std::string& locale, double latitude,
+        double longitude);
+    void DeleteLeastRecentlyUsedEntry();
+
+    size_t capacity_;
+    double validDistance_;
+    int64_t rowSpan_;
+    std::map<CellKey, GeoAddressCacheEntryList> cells_;
+    // most recently used first
+    GeoAddressCacheEntryList lruList_;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    uint64_t evictionCount_ = 0;
+};
+} // namespace Location
+} // namespace OHOS
+#endif // FEATURE_GEOCODE_SUPPORT
+#endif // GEO_ADDRESS_CACHE_H
@@ -38,6 +38,7 @@
 #include "ability_connect_callback_interface.h"
 #include "i_geocode_callback.h"
 #include "geo_convert_request.h"
+#include "geo_address_cache.h"
 
 namespace OHOS {
 namespace Location {
@@ -76,6 +77,13 @@ public:
     void OnResults(std::list<std::shared_ptr<GeoAddress>> &results) override;
     void OnErrorReport(const int errorCode) override;
     GeoConvertRequest request_;
+    // nonzero when identical reverse geocoding requests wait for this answer
+    uint64_t flightId_ = 0;
+};
+
+struct InFlightReverseGeocode {
+    std::shared_ptr<GeoConvertRequest> request;
+    std::list<std::shared_ptr<GeoConvertRequest>> waiters;
 };
 
 class GeoConvertService : public SystemAbility, public GeoConvertServiceStub {
@@ -114,9 +122,18 @@ public:
     std::list<std::shared_ptr<GeoAddress>> GetCahedGeoAddress(
         std::unique_ptr<GeoConvertRequest> geoConvertRequest);
     void AddCahedGeoAddress(GeoConvertRequest geoConvertRequest, MessageParcel& dataParcel);
+    void AddCahedGeoAddress(const GeoConvertRequest& geoConvertRequest,
+        const std::list<std::shared_ptr<GeoAddress>>& result);
+    bool ReadResultFromParcel(MessageParcel& dataParcel, std::list<std::shared_ptr<GeoAddress>>& result);
     bool WriteResultToParcel(const std::list<std::shared_ptr<GeoAddress>> result, MessageParcel& data);
     void SendCacheAddressToRequest(
         std::unique_ptr<GeoConvertRequest> geoConvertRequest, std::list<std::shared_ptr<GeoAddress>> result);
+    bool JoinInFlightReverseGeocode(const GeoConvertRequest& geoConvertRequest);
+    uint64_t AddInFlightReverseGeocode(const GeoConvertRequest& geoConvertRequest);
+    void RemoveInFlightReverseGeocode(uint64_t flightId);
+    void FailInFlightReverseGeocodes();
+    void ReportInFlightReverseGeocode(uint64_t flightId, int errCode,
+        const std::list<std::shared_ptr<GeoAddress>>& result);
 private:
     bool Init();
     static void SaDumpInfo(std::string& result);
@@ -129,7 +146,8 @@ private:
     bool IsConnecting();
     void RegisterGeoServiceDeathRecipient();
     void UnRegisterGeoServiceDeathRecipient();
-    void DeleteAgedGeoAddress();
+    void DumpGeoAddressCache(std::string& result);
+    void SendErrorToRequest(const std::shared_ptr<GeoConvertRequest>& geoConvertRequest, int errCode);
 
     bool mockEnabled_ = false;
     bool registerToService_ = false;
@@ -146,8 +164,11 @@ private:
         sptr<GeoServiceDeathRecipient>(new (std::nothrow) GeoServiceDeathRecipient());
     std::mutex connectStateMutex_;
     ServiceConnectState connectState_ = ServiceConnectState::STATE_DISCONNECT;
-    std::mutex cachedGeoAddressMapListMutex_;
-    std::map<std::shared_ptr<GeoConvertRequest>, std::list<std::shared_ptr<GeoAddress>>> cachedGeoAddressMapList_;
+    std::mutex geoAddressCacheMutex_;
+    std::unique_ptr<GeoAddressCache> geoAddressCache_;
+    std::mutex inFlightMutex_;
+    uint64_t nextFlightId_ = 1;
+    std::map<uint64_t, InFlightReverseGeocode> inFlightReverseGeocodes_;
 };
 } // namespace OHOS
 } // namespace Location
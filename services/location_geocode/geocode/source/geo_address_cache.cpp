@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef FEATURE_GEOCODE_SUPPORT
+#include "geo_address_cache.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "location.h"
+
+namespace OHOS {
+namespace Location {
+namespace {
+const double CELL_SIZE_DEGREE = 0.001;
+// a latitude degree is at least 110.5km, a longitude degree shrinks with the cosine of the latitude
+const double MIN_METERS_PER_DEGREE = 110000.0;
+const double MAX_LATITUDE = 90.0;
+const double MAX_LONGITUDE = 180.0;
+const double DEGREE_PI = 180.0;
+const int64_t COLUMN_NUM = static_cast<int64_t>(std::llround(2 * MAX_LONGITUDE / CELL_SIZE_DEGREE));
+}
+
+GeoAddressCache::GeoAddressCache(size_t capacity, double validDistance)
+    : capacity_(std::max(capacity, static_cast<size_t>(1))), validDistance_(std::max(validDistance, 0.0))
+{
+    rowSpan_ = static_cast<int64_t>(std::ceil(validDistance_ / (MIN_METERS_PER_DEGREE * CELL_SIZE_DEGREE)));
+}
+
+int64_t GeoAddressCache::GetRowIndex(double latitude) const
+{
+    return static_cast<int64_t>(std::floor((latitude + MAX_LATITUDE) / CELL_SIZE_DEGREE));
+}
+
+int64_t GeoAddressCache::GetColumnIndex(double longitude) const
+{
+    int64_t column = static_cast<int64_t>(std::floor((longitude + MAX_LONGITUDE) / CELL_SIZE_DEGREE));
+    return ((column % COLUMN_NUM) + COLUMN_NUM) % COLUMN_NUM;
+}
+
+int64_t GeoAddressCache::GetColumnSpan(double latitude) const
+{
+    // the cells are narrowest at the row edge closest to the pole
+    double edgeLatitude = std::min(std::fabs(latitude) + (rowSpan_ + 1) * CELL_SIZE_DEGREE, MAX_LATITUDE);
+    double cellWidth = MIN_METERS_PER_DEGREE * std::cos(edgeLatitude * M_PI / DEGREE_PI) * CELL_SIZE_DEGREE;
+    if (cellWidth <= 0.0 || validDistance_ / cellWidth >= COLUMN_NUM / 2) {
+        return COLUMN_NUM / 2;
+    }
+    return static_cast<int64_t>(std::ceil(validDistance_ / cellWidth));
+}
+
+std::shared_ptr<GeoAddressCacheEntry> GeoAddressCache::FindNearestEntry(const std::string& locale,
+    double latitude, double longitude)
+{
+    std::shared_ptr<GeoAddressCacheEntry> nearestEntry = nullptr;
+    double nearestDistance = validDistance_;
+    auto measureCell = [&](const GeoAddressCacheEntryList& cell) {
+        for (const auto& entry : cell) {
+            double distance = Location::GetDistanceBetweenLocations(entry->latitude, entry->longitude,
+                latitude, longitude);
+            if (distance <= nearestDistance) {
+                nearestDistance = distance;
+                nearestEntry = entry;
+            }
+        }
+    };
+    int64_t row = GetRowIndex(latitude);
+    int64_t column = GetColumnIndex(longitude);
+    int64_t columnSpan = GetColumnSpan(latitude);
+    // near the poles a row holds more candidate columns than the cache holds cells, walk the cached cells
+    // of the row instead of probing every column
+    bool isWideSpan = static_cast<size_t>(2 * columnSpan + 1) > cells_.size();
+    for (int64_t i = row - rowSpan_; i <= row + rowSpan_; i++) {
+        if (!isWideSpan) {
+            for (int64_t j = column - columnSpan; j <= column + columnSpan; j++) {
+                auto cell = cells_.find(std::make_tuple(locale, i, ((j % COLUMN_NUM) + COLUMN_NUM) % COLUMN_NUM));
+                if (cell != cells_.end()) {
+                    measureCell(cell->second);
+                }
+            }
+            continue;
+        }
+        for (auto cell = cells_.lower_bound(std::make_tuple(locale, i, static_cast<int64_t>(0)));
+            cell != cells_.end() && std::get<0>(cell->first) == locale && std::get<1>(cell->first) == i; ++cell) {
+            int64_t columnDistance = std::abs(std::get<2>(cell->first) - column);
+            if (std::min(columnDistance, COLUMN_NUM - columnDistance) <= columnSpan) {
+                measureCell(cell->second);
+            }
+        }
+    }
+    return nearestEntry;
+}
+
+std::list<std::shared_ptr<GeoAddress>> GeoAddressCache::Get(const std::string& locale, double latitude,
+    double longitude, int32_t maxItems)
+{
+    std::list<std::shared_ptr<GeoAddress>> result;
+    auto entry = FindNearestEntry(locale, latitude, longitude);
+    if (entry == nullptr) {
+        missCount_++;
+        return result;
+    }
+    hitCount_++;
+    lruList_.splice(lruList_.begin(), lruList_, entry->lruIter);
+    for (auto iter = entry->addresses.begin();
+        iter != entry->addresses.end() && result.size() < static_cast<size_t>(std::max(maxItems, 0)); ++iter) {
+        result.push_back(*iter);
+    }
+    return result;
+}
+
+void GeoAddressCache::Put(const std::string& locale, double latitude, double longitude,
+    const std::list<std::shared_ptr<GeoAddress>>& addresses)
+{
+    // the first result cached for a position stays until it is evicted
+    auto existingEntry = FindNearestEntry(locale, latitude, longitude);
+    if (existingEntry != nullptr) {
+        lruList_.splice(lruList_.begin(), lruList_, existingEntry->lruIter);
+        return;
+    }
+    if (lruList_.size() >= capacity_) {
+        DeleteLeastRecentlyUsedEntry();
+    }
+    auto entry = std::make_shared<GeoAddressCacheEntry>();
+    entry->locale = locale;
+    entry->latitude = latitude;
+    entry->longitude = longitude;
+    entry->row = GetRowIndex(latitude);
+    entry->column = GetColumnIndex(longitude);
+    entry->addresses = addresses;
+    auto& cell = cells_[std::make_tuple(locale, entry->row, entry->column)];
+    entry->cellIter = cell.insert(cell.end(), entry);
+    entry->lruIter = lruList_.insert(lruList_.begin(), entry);
+}
+
+void GeoAddressCache::DeleteLeastRecentlyUsedEntry()
+{
+    if (lruList_.empty()) {
+        return;
+    }
+    auto entry = lruList_.back();
+    lruList_.pop_back();
+    auto cell = cells_.find(std::make_tuple(entry->locale, entry->row, entry->column));
+    if (cell != cells_.end()) {
+        cell->second.erase(entry->cellIter);
+        if (cell->second.empty()) {
+            cells_.erase(cell);
+        }
+    }
+    evictionCount_++;
+}
+
+size_t GeoAddressCache::Size() const
+{
+    return lruList_.size();
+}
+
+size_t GeoAddressCache::GetCapacity() const
+{
+    return capacity_;
+}
+
+void GeoAddressCache::Clear()
+{
+    cells_.clear();
+    lruList_.clear();
+}
+
+void GeoAddressCache::DumpInfo(std::string& result) const
+{
+    result.append("GeoAddress cache size: ").append(std::to_string(lruList_.size()))
+        .append(", capacity: ").append(std::to_string(capacity_))
+        .append(", hit: ").append(std::to_string(hitCount_))
+        .append(", miss: ").append(std::to_string(missCount_))
+        .append(", eviction: ").append(std::to_string(evictionCount_)).append("\n");
+}
+} // namespace Location
+} // namespace OHOS
+#endif // FEATURE_GEOCODE_SUPPORT
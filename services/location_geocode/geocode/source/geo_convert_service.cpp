@@ -42,7 +42,9 @@ const uint32_t EVENT_INTERVAL_UNITE = 1000;
 const int UNLOAD_GEOCONVERT_DELAY_TIME = 10 * EVENT_INTERVAL_UNITE;
 const int TIMEOUT_WATCHDOG = 60; // s
 const int MAX_CACHED_VALID_DISTANCE = 100; // m
-const int MAX_CACHED_NUM = 10;
+// waiters of a reverse geocoding request the backend never answers are failed after this delay
+const int IN_FLIGHT_REVERSE_GEOCODE_TIMEOUT = 10 * EVENT_INTERVAL_UNITE;
+const std::string IN_FLIGHT_REVERSE_GEOCODE_TASK = "geoconvert_in_flight_";
 static const int MAX_RESULT = 10;
 
 GeoConvertService* GeoConvertService::GetInstance()
@@ -53,6 +55,8 @@ GeoConvertService* GeoConvertService::GetInstance()
 
 GeoConvertService::GeoConvertService() : SystemAbility(LOCATION_GEO_CONVERT_SA_ID, true)
 {
+    geoAddressCache_ = std::make_unique<GeoAddressCache>(
+        LocationConfigManager::GetInstance()->GetGeocodeCacheCapacity(), MAX_CACHED_VALID_DISTANCE);
 #ifndef TDD_CASES_ENABLED
     geoConvertHandler_ =
         std::make_shared<GeoConvertHandler>(AppExecFwk::EventRunner::Create(true, AppExecFwk::ThreadMode::FFRT));
@@ -388,6 +392,7 @@ void GeoConvertService::DisconnectAbilityConnect()
         AAFwk::AbilityManagerClient::GetInstance()->DisconnectAbility(conn_);
         SetServiceConnectState(ServiceConnectState::STATE_DISCONNECT);
         conn_ = nullptr;
+        FailInFlightReverseGeocodes();
         LBSLOGI(GEO_CONVERT, "UnloadGeoConvert OnStop and disconnect");
     }
 }
@@ -401,6 +406,7 @@ void GeoConvertService::SaDumpInfo(std::string& result)
 {
     result += "GeoConvert enable status: false";
     result += "\n";
+    GeoConvertService::GetInstance()->DumpGeoAddressCache(result);
 }
 
 int32_t GeoConvertService::Dump(int32_t fd, const std::vector<std::u16string>& args)
@@ -492,100 +498,183 @@ bool GeoConvertService::IsConnecting()
     return connectState_ == ServiceConnectState::STATE_CONNECTTING;
 }
 
-void GeoConvertService::AddCahedGeoAddress(GeoConvertRequest geoConvertRequest, MessageParcel& dataParcel)
+bool GeoConvertService::ReadResultFromParcel(MessageParcel& dataParcel,
+    std::list<std::shared_ptr<GeoAddress>>& result)
 {
-    auto geoAddressList = GetCahedGeoAddress(std::make_unique<GeoConvertRequest>(geoConvertRequest));
-    if (geoAddressList.size() > 0) {
-        return;
-    }
     int errCode = dataParcel.ReadInt32();
     if (errCode != 0) {
         LBSLOGE(GEO_CONVERT, "something wrong, errCode = %{public}d", errCode);
-        return;
+        return false;
     }
     int cnt = dataParcel.ReadInt32();
     if (cnt > MAX_RESULT) {
         cnt = MAX_RESULT;
     }
-    std::list<std::shared_ptr<GeoAddress>> result;
     for (int i = 0; i < cnt; i++) {
         auto geoAddress = GeoAddress::Unmarshalling(dataParcel);
         if (geoAddress == nullptr) {
             continue;
         }
+        result.push_back(std::make_shared<GeoAddress>(*geoAddress));
+    }
+    return true;
+}
+
+void GeoConvertService::AddCahedGeoAddress(GeoConvertRequest geoConvertRequest, MessageParcel& dataParcel)
+{
+    std::list<std::shared_ptr<GeoAddress>> result;
+    if (!ReadResultFromParcel(dataParcel, result)) {
+        return;
+    }
+    AddCahedGeoAddress(geoConvertRequest, result);
+}
+
+void GeoConvertService::AddCahedGeoAddress(const GeoConvertRequest& geoConvertRequest,
+    const std::list<std::shared_ptr<GeoAddress>>& result)
+{
+    if (result.empty()) {
+        return;
+    }
+    for (auto& geoAddress : result) {
         if (geoAddress->placeName_.empty()) {
             return;
         }
-        result.push_back(std::make_shared<GeoAddress>(*geoAddress));
-    }
-    std::unique_lock<std::mutex> uniqueLock(cachedGeoAddressMapListMutex_);
-    if (static_cast<int32_t>(cachedGeoAddressMapList_.size()) >= MAX_CACHED_NUM) {
-        DeleteAgedGeoAddress();
     }
-    geoConvertRequest.SetTimeStamp(CommonUtils::GetCurrentTimeStamp()); // utc time
-    cachedGeoAddressMapList_[std::make_shared<GeoConvertRequest>(geoConvertRequest)] = result;
+    std::unique_lock<std::mutex> uniqueLock(geoAddressCacheMutex_);
+    geoAddressCache_->Put(geoConvertRequest.GetLocale(), geoConvertRequest.GetLatitude(),
+        geoConvertRequest.GetLongitude(), result);
+}
+
+void GeoConvertService::DumpGeoAddressCache(std::string& result)
+{
+    std::unique_lock<std::mutex> uniqueLock(geoAddressCacheMutex_);
+    geoAddressCache_->DumpInfo(result);
 }
 
 std::list<std::shared_ptr<GeoAddress>> GeoConvertService::GetCahedGeoAddress(
     std::unique_ptr<GeoConvertRequest> geoConvertRequest)
 {
-    std::unique_lock<std::mutex> uniqueLock(cachedGeoAddressMapListMutex_);
-    std::list<std::shared_ptr<GeoAddress>> result;
     if (geoConvertRequest == nullptr) {
-        return result;
+        return std::list<std::shared_ptr<GeoAddress>>();
     }
-    for (auto iter = cachedGeoAddressMapList_.begin(); iter != cachedGeoAddressMapList_.end(); ++iter) {
-        auto request = iter->first;
-        if (request == nullptr) {
-            continue;
-        }
-        if (request->GetLocale() != geoConvertRequest->GetLocale()) {
-            continue;
-        }
-        if (Location::GetDistanceBetweenLocations(request->GetLatitude(), request->GetLongitude(),
-            geoConvertRequest->GetLatitude(), geoConvertRequest->GetLongitude()) > MAX_CACHED_VALID_DISTANCE) {
-            continue;
+    std::unique_lock<std::mutex> uniqueLock(geoAddressCacheMutex_);
+    return geoAddressCache_->Get(geoConvertRequest->GetLocale(), geoConvertRequest->GetLatitude(),
+        geoConvertRequest->GetLongitude(), geoConvertRequest->GetMaxItems());
+}
+
+void GeoConvertService::SendCacheAddressToRequest(
+    std::unique_ptr<GeoConvertRequest> geoConvertRequest, std::list<std::shared_ptr<GeoAddress>> result)
+{
+    if (geoConvertRequest == nullptr || geoConvertRequest->GetCallback() == nullptr) {
+        return;
+    }
+    MessageParcel dataParcel;
+    MessageParcel reply;
+    MessageOption option;
+    dataParcel.WriteInterfaceToken(geoConvertRequest->GetCallback()->GetInterfaceDescriptor());
+    WriteResultToParcel(result, dataParcel);
+    int32_t errCode = geoConvertRequest->GetCallback()->SendRequest(
+        GeoCodeCallback::RECEIVE_GEOCODE_INFO_EVENT, dataParcel, reply, option);
+    LBSLOGD(GEO_CONVERT, "SendRequest RECEIVE_GEOCODE_INFO_EVENT, errCode=%{public}d", errCode);
+}
+
+bool GeoConvertService::JoinInFlightReverseGeocode(const GeoConvertRequest& geoConvertRequest)
+{
+    std::unique_lock<std::mutex> uniqueLock(inFlightMutex_);
+    for (auto& inFlightPair : inFlightReverseGeocodes_) {
+        auto& inFlight = inFlightPair.second;
+        if (inFlight.request->GetLocale() == geoConvertRequest.GetLocale() &&
+            inFlight.request->GetMaxItems() >= geoConvertRequest.GetMaxItems() &&
+            Location::GetDistanceBetweenLocations(inFlight.request->GetLatitude(),
+            inFlight.request->GetLongitude(), geoConvertRequest.GetLatitude(),
+            geoConvertRequest.GetLongitude()) <= MAX_CACHED_VALID_DISTANCE) {
+            inFlight.waiters.push_back(std::make_shared<GeoConvertRequest>(geoConvertRequest));
+            return true;
         }
-        request->SetTimeStamp(CommonUtils::GetCurrentTimeStamp()); // utc time
-        request->SetPriority(request->GetPriority() + 1);
-        if (iter->second.size() > static_cast<uint32_t>(geoConvertRequest->GetMaxItems())) {
-            for (auto geoAddress = iter->second.begin();
-                geoAddress != iter->second.end() &&
-                result.size() < static_cast<uint32_t>(geoConvertRequest->GetMaxItems());
-                geoAddress++) {
-                result.push_back(*geoAddress);
-            }
-        } else {
-            result = iter->second;
+    }
+    return false;
+}
+
+uint64_t GeoConvertService::AddInFlightReverseGeocode(const GeoConvertRequest& geoConvertRequest)
+{
+    uint64_t flightId = 0;
+    {
+        std::unique_lock<std::mutex> uniqueLock(inFlightMutex_);
+        flightId = nextFlightId_++;
+        InFlightReverseGeocode inFlight;
+        inFlight.request = std::make_shared<GeoConvertRequest>(geoConvertRequest);
+        inFlightReverseGeocodes_[flightId] = inFlight;
+    }
+    if (geoConvertHandler_ != nullptr) {
+        auto task = [this, flightId]() {
+            LBSLOGE(GEO_CONVERT, "reverse geocoding request %{public}s timeout", std::to_string(flightId).c_str());
+            ReportInFlightReverseGeocode(flightId, ERRCODE_REVERSE_GEOCODING_FAIL, {});
+        };
+        geoConvertHandler_->PostTask(task, IN_FLIGHT_REVERSE_GEOCODE_TASK + std::to_string(flightId),
+            IN_FLIGHT_REVERSE_GEOCODE_TIMEOUT);
+    }
+    return flightId;
+}
+
+void GeoConvertService::RemoveInFlightReverseGeocode(uint64_t flightId)
+{
+    {
+        std::unique_lock<std::mutex> uniqueLock(inFlightMutex_);
+        inFlightReverseGeocodes_.erase(flightId);
+    }
+    if (geoConvertHandler_ != nullptr) {
+        geoConvertHandler_->RemoveTask(IN_FLIGHT_REVERSE_GEOCODE_TASK + std::to_string(flightId));
+    }
+}
+
+void GeoConvertService::FailInFlightReverseGeocodes()
+{
+    // the backend is gone, none of the requests sent to it will be answered
+    std::vector<uint64_t> flightIds;
+    {
+        std::unique_lock<std::mutex> uniqueLock(inFlightMutex_);
+        for (auto& inFlightPair : inFlightReverseGeocodes_) {
+            flightIds.push_back(inFlightPair.first);
         }
-        return result;
     }
-    return result;
+    for (auto flightId : flightIds) {
+        ReportInFlightReverseGeocode(flightId, ERRCODE_REVERSE_GEOCODING_FAIL, {});
+    }
 }
 
-void GeoConvertService::DeleteAgedGeoAddress()
+void GeoConvertService::ReportInFlightReverseGeocode(uint64_t flightId, int errCode,
+    const std::list<std::shared_ptr<GeoAddress>>& result)
 {
-    int minPriority = 0;
-    int minTimeStamp = 0;
-    auto iterDelete = cachedGeoAddressMapList_.begin();
-    for (auto iter = cachedGeoAddressMapList_.begin(); iter != cachedGeoAddressMapList_.end(); ++iter) {
-        auto geoConvertRequest = iter->first;
-        if (geoConvertRequest == nullptr) {
-            iterDelete = iter;
-            break;
+    std::list<std::shared_ptr<GeoConvertRequest>> waiters;
+    {
+        std::unique_lock<std::mutex> uniqueLock(inFlightMutex_);
+        auto iter = inFlightReverseGeocodes_.find(flightId);
+        if (iter == inFlightReverseGeocodes_.end()) {
+            return;
+        }
+        waiters.swap(iter->second.waiters);
+        inFlightReverseGeocodes_.erase(iter);
+    }
+    if (geoConvertHandler_ != nullptr) {
+        geoConvertHandler_->RemoveTask(IN_FLIGHT_REVERSE_GEOCODE_TASK + std::to_string(flightId));
+    }
+    LBSLOGD(GEO_CONVERT, "report reverse geocoding result to %{public}zu waiters", waiters.size());
+    for (auto& waiter : waiters) {
+        if (errCode != ERRCODE_SUCCESS) {
+            SendErrorToRequest(waiter, errCode);
+            continue;
         }
-        if (geoConvertRequest->GetPriority() < minPriority ||
-            (geoConvertRequest->GetPriority() == minPriority && geoConvertRequest->GetTimeStamp() < minTimeStamp)) {
-            minPriority = geoConvertRequest->GetPriority();
-            minTimeStamp = geoConvertRequest->GetTimeStamp();
-            iterDelete = iter;
+        std::list<std::shared_ptr<GeoAddress>> waiterResult;
+        for (auto iter = result.begin();
+            iter != result.end() && waiterResult.size() < static_cast<size_t>(waiter->GetMaxItems()); ++iter) {
+            waiterResult.push_back(*iter);
         }
+        SendCacheAddressToRequest(std::make_unique<GeoConvertRequest>(*waiter), waiterResult);
     }
-    cachedGeoAddressMapList_.erase(iterDelete);
 }
 
-void GeoConvertService::SendCacheAddressToRequest(
-    std::unique_ptr<GeoConvertRequest> geoConvertRequest, std::list<std::shared_ptr<GeoAddress>> result)
+void GeoConvertService::SendErrorToRequest(const std::shared_ptr<GeoConvertRequest>& geoConvertRequest,
+    int errCode)
 {
     if (geoConvertRequest == nullptr || geoConvertRequest->GetCallback() == nullptr) {
         return;
@@ -594,10 +683,8 @@ void GeoConvertService::SendCacheAddressToRequest(
     MessageParcel reply;
     MessageOption option;
     dataParcel.WriteInterfaceToken(geoConvertRequest->GetCallback()->GetInterfaceDescriptor());
-    WriteResultToParcel(result, dataParcel);
-    int32_t errCode = geoConvertRequest->GetCallback()->SendRequest(
-        GeoCodeCallback::RECEIVE_GEOCODE_INFO_EVENT, dataParcel, reply, option);
-    LBSLOGD(GEO_CONVERT, "SendRequest RECEIVE_GEOCODE_INFO_EVENT, errCode=%{public}d", errCode);
+    dataParcel.WriteInt32(errCode);
+    geoConvertRequest->GetCallback()->SendRequest(GeoCodeCallback::ERROR_INFO_EVENT, dataParcel, reply, option);
 }
 
 GeoServiceDeathRecipient::GeoServiceDeathRecipient()
@@ -615,6 +702,7 @@ void GeoServiceDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
         LBSLOGI(GEO_CONVERT, "geo OnRemoteDied");
         geoConvertService->ResetServiceProxy();
         geoConvertService->SetServiceConnectState(ServiceConnectState::STATE_DISCONNECT);
+        geoConvertService->FailInFlightReverseGeocodes();
     }
 }
 
@@ -677,18 +765,26 @@ void GeoConvertHandler::SendGeocodeRequest(const AppExecFwk::InnerEvent::Pointer
                 std::make_unique<GeoConvertRequest>(*geoConvertRequest), result);
             return;
         }
+        // the same position is being resolved, share that answer instead of asking the backend again
+        if (geoConvertService->JoinInFlightReverseGeocode(*geoConvertRequest)) {
+            return;
+        }
     }
     MessageParcel dataParcel;
     MessageParcel replyParcel;
     MessageOption option;
     sptr<GeoCodeCallback> callback = new GeoCodeCallback();
     callback->request_ = *geoConvertRequest;
+    if (geoConvertRequest->GetRequestType() == GeoCodeType::REQUEST_REVERSE_GEOCODE) {
+        callback->flightId_ = geoConvertService->AddInFlightReverseGeocode(*geoConvertRequest);
+    }
     geoConvertRequest->SetCallback(callback);
     geoConvertRequest->Marshalling(dataParcel);
     bool ret = geoConvertService->SendGeocodeRequest(static_cast<int>(geoConvertRequest->GetRequestType()),
         dataParcel, replyParcel, option);
     if (!ret) {
         LBSLOGE(GEO_CONVERT, "SendGeocodeRequest failed errcode");
+        geoConvertService->RemoveInFlightReverseGeocode(callback->flightId_);
     }
 }
 
@@ -719,23 +815,31 @@ int GeoCodeCallback::OnRemoteRequest(
     dataParcel.Append(data);
     switch (code) {
         case RECEIVE_GEOCODE_INFO_EVENT: {
-            if (request_.GetCallback() == nullptr) {
-                break;
+            if (request_.GetCallback() != nullptr) {
+                int32_t errCode =
+                    request_.GetCallback()->SendRequest(RECEIVE_GEOCODE_INFO_EVENT, dataParcel, reply, option);
+                LBSLOGD(GEO_CONVERT, "SendRequest RECEIVE_GEOCODE_INFO_EVENT, errCode=%{public}d", errCode);
             }
-            int32_t errCode =
-                request_.GetCallback()->SendRequest(RECEIVE_GEOCODE_INFO_EVENT, dataParcel, reply, option);
-            LBSLOGD(GEO_CONVERT, "SendRequest RECEIVE_GEOCODE_INFO_EVENT, errCode=%{public}d", errCode);
             if (request_.GetRequestType() == GeoCodeType::REQUEST_REVERSE_GEOCODE) {
-                GeoConvertService::GetInstance()->AddCahedGeoAddress(request_, data);
+                auto geoConvertService = GeoConvertService::GetInstance();
+                std::list<std::shared_ptr<GeoAddress>> result;
+                bool isSuccess = geoConvertService->ReadResultFromParcel(data, result);
+                if (isSuccess) {
+                    geoConvertService->AddCahedGeoAddress(request_, result);
+                }
+                geoConvertService->ReportInFlightReverseGeocode(flightId_,
+                    isSuccess ? ERRCODE_SUCCESS : ERRCODE_REVERSE_GEOCODING_FAIL, result);
             }
             break;
         }
         case ERROR_INFO_EVENT: {
-            if (request_.GetCallback() == nullptr) {
-                break;
+            if (request_.GetCallback() != nullptr) {
+                int32_t errCode = request_.GetCallback()->SendRequest(ERROR_INFO_EVENT, dataParcel, reply, option);
+                LBSLOGD(GEO_CONVERT, "SendRequest ERROR_INFO_EVENT, errCode=%{public}d", errCode);
             }
-            int32_t errCode = request_.GetCallback()->SendRequest(ERROR_INFO_EVENT, dataParcel, reply, option);
-            LBSLOGD(GEO_CONVERT, "SendRequest ERROR_INFO_EVENT, errCode=%{public}d", errCode);
+            int errorCode = data.ReadInt32();
+            GeoConvertService::GetInstance()->ReportInFlightReverseGeocode(flightId_,
+                errorCode != ERRCODE_SUCCESS ? errorCode : ERRCODE_REVERSE_GEOCODING_FAIL, {});
             break;
         }
         default: {
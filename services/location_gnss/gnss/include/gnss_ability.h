@@ -17,7 +17,9 @@
 #define GNSS_ABILITY_H
 #ifdef FEATURE_GNSS_SUPPORT
 
+#include <map>
 #include <mutex>
+#include <set>
 #include <singleton.h>
 #include <v2_0/ignss_interface.h>
 #ifdef HDF_DRIVERS_INTERFACE_GEOFENCE_ENABLE
@@ -108,6 +110,7 @@ enum class GnssAbilityInterfaceCode {
     ADD_FUSION_FENCE = 0x010B,
     REMOVE_FUSION_FENCE = 0x010C,
     IS_FUSION_FENCE_SUPPORTED = 0x010D,
+    FLUSH_NMEA = 0x010E,
 };
 
 enum GnssBatchingWorkStatus {
@@ -130,6 +133,21 @@ typedef struct {
     std::vector<CoordinateSystemType> coordinateSystemTypes;
 } FenceStruct;
 
+typedef struct {
+    AppIdentity identity;
+    // whether reports may be delivered, and the permission/account/freeze state it was computed under
+    bool isDeliverable = false;
+    uint64_t permissionGeneration = 0;
+    uint64_t accountGeneration = 0;
+    uint64_t freezeGeneration = 0;
+    int64_t checkTime = 0; // boot time ms
+    // reports are coalesced to at most one per interval, 0 delivers at the chipset rate
+    int32_t minIntervalMs = 0;
+    int64_t lastDeliverTime = 0; // boot time ms
+    std::string pendingNmea; // sentences held back since the last delivery
+    int64_t pendingNmeaTimestamp = 0; // chipset timestamp of the last held sentence
+} GnssCallbackSubscriber;
+
 class GnssHandler : public AppExecFwk::EventHandler {
 public:
     explicit GnssHandler(const std::shared_ptr<AppExecFwk::EventRunner>& runner);
@@ -159,6 +177,7 @@ private:
     void HandleSendNetworkLocation(const AppExecFwk::InnerEvent::Pointer& event);
     void HandleRestoreGeofenceRequest(const AppExecFwk::InnerEvent::Pointer& event);
     void HandleConnectHdi(const AppExecFwk::InnerEvent::Pointer& event);
+    void HandleFlushNmea(const AppExecFwk::InnerEvent::Pointer& event);
 
     using GnssEventProcessHandle = std::function<void(const AppExecFwk::InnerEvent::Pointer &)>;
     using GnssEventProcessMap = std::map<uint32_t, GnssEventProcessHandle>;
@@ -183,9 +202,11 @@ public:
     LocationErrCode SendLocationRequest(WorkRecord &workrecord) override;
     LocationErrCode SetEnable(bool state) override;
     LocationErrCode RefrashRequirements() override;
-    LocationErrCode RegisterGnssStatusCallback(const sptr<IRemoteObject>& callback,  AppIdentity &identity) override;
+    LocationErrCode RegisterGnssStatusCallback(const sptr<IRemoteObject>& callback, AppIdentity &identity,
+        int32_t minIntervalMs) override;
     LocationErrCode UnregisterGnssStatusCallback(const sptr<IRemoteObject>& callback) override;
-    LocationErrCode RegisterNmeaMessageCallback(const sptr<IRemoteObject>& callback, AppIdentity &identity) override;
+    LocationErrCode RegisterNmeaMessageCallback(const sptr<IRemoteObject>& callback, AppIdentity &identity,
+        int32_t minIntervalMs) override;
     LocationErrCode UnregisterNmeaMessageCallback(const sptr<IRemoteObject>& callback) override;
     LocationErrCode RegisterCachedCallback(const std::unique_ptr<CachedGnssLocationsRequest>& request,
         const sptr<IRemoteObject>& callback) override;
@@ -210,6 +231,7 @@ public:
     bool IsSupportBatching() override;
     void ReportGnssSessionStatus(int status);
     void ReportNmea(int64_t timestamp, const std::string &nmea);
+    void FlushPendingNmea(bool isForced);
     void ReportSv(const std::unique_ptr<SatelliteStatus> &sv);
     void ReportCachedLocation(const std::vector<std::unique_ptr<Location>> &cacheLocations);
     LocationErrCode EnableMock() override;
@@ -244,6 +266,7 @@ public:
     bool CheckIfHdiConnected();
     void RestGnssWorkStatus();
     void ResetGnssBatchingWorkStatus();
+    bool IsLocationRequestSuperseded(int64_t requestSeq);
     bool RegisterGnssGeofenceCallback(std::shared_ptr<GeofenceRequest> &request,
         const sptr<IRemoteObject>& callback);
     bool UnregisterGnssGeofenceCallback(int fenceId);
@@ -255,8 +278,13 @@ public:
     void NotifyGnssfenceStatusByFenceExtension(const std::shared_ptr<GeofenceRequest> &request, int event);
     void NotifyGnssfenceStatusByCallback(const std::shared_ptr<GeofenceRequest> &request, int event);
     bool IsAppBackground(std::string bundleName, uint32_t tokenId, uint64_t tokenIdEx, pid_t uid, pid_t pid);
+    bool IsGeofenceRequestNeedSave(const std::shared_ptr<GeofenceRequest>& request);
+    void AppendGeoFenceRequestToFile(const std::shared_ptr<GeofenceRequest>& request, bool isRemoved);
     void SaveGeoFenceRequestToFile();
+    bool TrimGeoFenceJournalTail(int fd);
+    bool SyncGeoFenceRequestFile(const std::string& filePath, int flags);
     std::vector<std::shared_ptr<GeofenceRequest>> ReadGeoFenceRequestFromFile();
+    std::vector<std::shared_ptr<GeofenceRequest>> ReadLegacyGeoFenceRequestFromFile();
     std::string ReadFileContent();
     void ReportGeofenceOperationResult(int fenceId, int type, int result);
 #endif
@@ -289,14 +317,26 @@ private:
     bool IsGnssEnabled();
     bool IsGnssBatchingEnabled();
     int GetBatchingRequestNum();
+    bool IsSwitchIgnoredInRecord(WorkRecord &workRecord);
     int32_t ReportMockedLocation(const std::shared_ptr<Location> location);
     bool CheckIfGnssConnecting();
+    bool IsSubscriberDeliverable(GnssCallbackSubscriber& subscriber, const std::string& reportName);
+    bool CoalesceNmea(GnssCallbackSubscriber& subscriber, int64_t timestamp, const std::string& nmea,
+        int64_t curTime);
+    void ScheduleNmeaFlush(int64_t flushTime, int64_t curTime);
     bool IsMockProcessing();
     void RegisterLocationHdiDeathRecipient();
     bool GetCommandFlags(std::unique_ptr<LocationCommand>& commands, GnssAuxiliaryDataType& flags);
     LocationErrCode SetPositionMode();
+    LocationErrCode SetPositionMode(const sptr<IGnssInterface>& gnssInterface);
+    int64_t GetFixIntervalByRequest();
+    void UpdateFixInterval();
+    void StartGnssSession();
+    sptr<IGnssInterface> GetGnssInterface();
+    void ResetGnssInterface();
     LocationErrCode SetCachePositionMode(int reportingPeriodSec, bool wakeUpCacheQueueFull);
-    void SendEvent(AppExecFwk::InnerEvent::Pointer& event, MessageParcel &reply);
+    bool SendEvent(AppExecFwk::InnerEvent::Pointer& event, MessageParcel &reply);
+    void UpdateLocationRequestSeq(int64_t requestSeq);
     void SendFusionFenceMessage(uint32_t code, MessageParcel &data, MessageParcel &reply);
     bool ExecuteFenceProcess(
         GnssInterfaceCode code, std::shared_ptr<GeofenceRequest>& request);
@@ -311,6 +351,10 @@ private:
     bool IsProcessRunning(pid_t pid, const uint32_t tokenId);
     bool CheckIfExceedsLimitForOneApp(const std::string& bundleName);
     void ReducedGeoFencesCount(const std::string& bundleName);
+    void AddGnssGeofenceRequest(const std::shared_ptr<GeofenceRequest>& request);
+    std::shared_ptr<GeofenceRequest> EraseGnssGeofenceRequest(int fenceId);
+    void BindGnssGeofenceCallback(int fenceId, const sptr<IRemoteObject>& callback);
+    void UnbindGnssGeofenceCallback(int fenceId, const sptr<IRemoteObject>& callback);
     void DeleteMinExpirationGeofenceRequest(const std::string& packageName);
     bool ConnectGnssHdi();
     int64_t GetReportingPeriodSecParam();
@@ -331,15 +375,20 @@ private:
     bool registerToAbility_ = false;
     std::atomic<int> gnssWorkingStatus_{GNSS_WORKING_STATUS_NONE};
     std::atomic<int> gnssBatchingWorkingStatus_{GNSS_BATCHING_WORKING_STATUS_NONE};
-    int64_t fixInterval_ = 1000;
+    // sequence of the latest queued work record, records queued with an older one are superseded by it
+    std::atomic<int64_t> locationRequestSeq_{0};
+    int64_t fixInterval_ = 1000; // ms, the tightest time interval among the gnss requests
     std::shared_ptr<GnssHandler> gnssHandler_;
     ServiceRunningState state_ = ServiceRunningState::STATE_NOT_START;
     ffrt::mutex gnssMutex_;
     ffrt::mutex batchingMutex_;
     ffrt::mutex nmeaMutex_;
     ffrt::mutex hdiMutex_;
-    std::map<sptr<IRemoteObject>, AppIdentity> gnssStatusCallbackMap_;
-    std::map<sptr<IRemoteObject>, AppIdentity> nmeaCallbackMap_;
+    ffrt::mutex gnssInterfaceMutex_;
+    sptr<IGnssInterface> gnssInterface_; // dropped on every hdi (re)connect
+    std::map<sptr<IRemoteObject>, GnssCallbackSubscriber> gnssStatusCallbackMap_;
+    std::map<sptr<IRemoteObject>, GnssCallbackSubscriber> nmeaCallbackMap_;
+    int64_t nmeaFlushTime_ = 0; // boot time ms the armed nmea flush fires at, 0 if none is armed
     std::map<sptr<IRemoteObject>, std::unique_ptr<CachedGnssLocationsRequest>> batchingCallbackMap_;
     std::map<sptr<IRemoteObject>, sptr<IRemoteObject::DeathRecipient>> gnssStatusDeathMap_;
     std::map<sptr<IRemoteObject>, sptr<IRemoteObject::DeathRecipient>> nmeaDeathMap_;
@@ -365,8 +414,15 @@ private:
     ffrt::mutex gnssGeofenceRequestListMutex_;
     ffrt::mutex notificationMapMutex_;
     ffrt::mutex fenceWantAgentMapMutex_;
-    std::vector<std::shared_ptr<GeofenceRequest>> gnssGeofenceRequestList_;
+    // fence id -> request, guarded by gnssGeofenceRequestListMutex_ together with the two indexes below
+    std::map<int, std::shared_ptr<GeofenceRequest>> gnssGeofenceRequestMap_;
     std::map<std::string, int> gnssGeofenceRequestCountMap_;
+    // transition callback -> fence ids registered through it, so a dead app is found without a scan
+    std::map<sptr<IRemoteObject>, std::set<int>> gnssGeofenceCallbackMap_;
+    std::string geofenceRequestFilePath_;
+    // records appended to the geofence journal since it was last compacted, and the fences it was compacted to
+    int geofenceJournalRecordNum_ = 0;
+    int geofenceJournalLiveNum_ = 0;
     std::mutex gnssQosSetMapMutex_;
     std::map<pid_t, bool> gnssQosSetMap_;
     void SetGnssHandlerQos();
@@ -45,8 +45,8 @@ public:
 private:
     void SendDummySvInfo();
     bool IsNeedSvIncrease();
-    bool IsSvTypeGps(const std::unique_ptr<SatelliteStatus> &sv, int index);
-    bool IsSvUsed(const std::unique_ptr<SatelliteStatus> &sv, int index);
+    bool IsSvTypeGps(const std::shared_ptr<SatelliteStatus> &sv, int index);
+    bool IsSvUsed(const std::shared_ptr<SatelliteStatus> &sv, int index);
     void AddDummySv(std::unique_ptr<SatelliteStatus> &sv, int svid, int cN0Dbhz);
     void ReportDummySv(const std::unique_ptr<SatelliteStatus> &sv);
     std::mutex svInfoMutex_;
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GNSS_INNER_EVENT_AGGREGATOR_H
+#define GNSS_INNER_EVENT_AGGREGATOR_H
+#ifdef FEATURE_GNSS_SUPPORT
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <v2_0/ignss_callback.h>
+
+namespace OHOS {
+namespace Location {
+using HDI::Location::Gnss::V2_0::LocationInfo;
+using HDI::Location::Gnss::V2_0::SatelliteStatusInfo;
+
+struct GnssLocationWindowStats {
+    int64_t count = 0;
+    double minAccuracy = 0.0;
+    double maxAccuracy = 0.0;
+    double sumAccuracy = 0.0;
+    int64_t lastFixTime = 0;
+    int64_t intervalCount = 0;
+    int64_t minInterval = 0;
+    int64_t maxInterval = 0;
+    int64_t sumInterval = 0;
+};
+
+struct GnssSatelliteWindowStats {
+    int64_t count = 0;
+    int64_t sumSatellites = 0;
+    int maxSatellites = 0;
+    int64_t sumUsedSatellites = 0;
+    int minUsedSatellites = 0;
+    int maxUsedSatellites = 0;
+};
+
+/*
+ * Folds the per-fix RECEIVE_GNSS_LOCATION and per-update RECEIVE_SATELLITESTATUSINFO inner events into
+ * windowed summaries. A window is flushed by the first report after it elapses, or by Flush when the
+ * gnss session stops. One raw event out of every rawEventSampleRate reports is still written, 0 disables them.
+ */
+class GnssInnerEventAggregator {
+public:
+    static GnssInnerEventAggregator* GetInstance();
+    GnssInnerEventAggregator();
+    GnssInnerEventAggregator(int64_t windowMs, int rawEventSampleRate);
+    virtual ~GnssInnerEventAggregator() = default;
+    void OnLocation(const LocationInfo& location, int64_t receiveTime);
+    void OnSatelliteStatus(const SatelliteStatusInfo& info, int64_t receiveTime);
+    void Flush();
+
+protected:
+    virtual void WriteInnerEvent(int event, std::vector<std::string>& names, std::vector<std::string>& values);
+
+private:
+    bool IsRawEventSampled(int64_t& reportCount);
+    bool TakeElapsedWindow(int64_t receiveTime, GnssLocationWindowStats& locationStats,
+        GnssSatelliteWindowStats& satelliteStats);
+    void WriteSummaryEvents(const GnssLocationWindowStats& locationStats,
+        const GnssSatelliteWindowStats& satelliteStats);
+    void WriteRawLocationEvent(const LocationInfo& location, int64_t receiveTime);
+    void WriteRawSatelliteStatusEvent(const SatelliteStatusInfo& info);
+
+    std::mutex mutex_;
+    int64_t windowMs_;
+    int rawEventSampleRate_;
+    int64_t windowStartTime_ = 0;
+    int64_t locationReportCount_ = 0;
+    int64_t satelliteReportCount_ = 0;
+    GnssLocationWindowStats locationStats_;
+    GnssSatelliteWindowStats satelliteStats_;
+};
+}  // namespace Location
+}  // namespace OHOS
+#endif // FEATURE_GNSS_SUPPORT
+#endif // GNSS_INNER_EVENT_AGGREGATOR_H
@@ -17,9 +17,16 @@
 #include "gnss_ability.h"
 
 #include <file_ex.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <thread>
+#include <tuple>
 #include <fstream>
 
+#include "active_account_cache.h"
 #include "agnss_ni_manager.h"
 #include "event_runner.h"
 #include "idevmgr_hdi.h"
@@ -35,6 +42,7 @@
 #include "common_utils.h"
 #include "fusion_fence_ability.h"
 #include "gnss_event_callback.h"
+#include "gnss_inner_event_aggregator.h"
 #include "i_cached_locations_callback.h"
 #include "location_config_manager.h"
 #include "location_dumper.h"
@@ -101,7 +109,22 @@ const int64_t INVALID_TIME = 0;
 const int TIMEOUT_WATCHDOG = 60; // s
 const int DEFAULT_FENCE_ID = -1;
 const int64_t MILL_TO_NANOS = 1000000;
+// permission changes of tokens without a location request are not watched, recheck them at this rate
+const int64_t SUBSCRIBER_RECHECK_INTERVAL_MS = 1000;
+// a coalesced nmea block is delivered early once it grows past this size
+const size_t MAX_PENDING_NMEA_SIZE = 32 * 1024;
+const int64_t DEFAULT_FIX_INTERVAL_MS = 1000;
+// longer intervals let the chipset lose its tracking state, apps are served from the cache instead
+const int64_t MAX_FIX_INTERVAL_MS = 60 * 1000;
 const std::string GEOFENCE_REQUEST_FILE_PATH = "/data/service/el2/public/location/geofenceRequest.conf";
+const std::string GEOFENCE_REQUEST_TMP_FILE_SUFFIX = ".tmp";
+// geofenceRequest.conf is a journal, "+<request json>" adds or updates a fence and "-<fenceId>" drops it
+const char GEOFENCE_JOURNAL_ADD = '+';
+const char GEOFENCE_JOURNAL_REMOVE = '-';
+// the journal is compacted once the records appended since the last compaction outnumber both this
+// floor and the fences it holds, which keeps the write cost per operation constant
+const int GEOFENCE_JOURNAL_COMPACT_MIN_RECORD_NUM = 64;
+const size_t GEOFENCE_JOURNAL_TAIL_SCAN_SIZE = 512;
 static const std::string SYSPARAM_GPS_SUPPORT = "const.location.gps.support";
 static const std::string SYSPARAM_GEOFENCE_SUPPORT = "const.location.support_geofence";
 static const std::string SYSPARAM_DEVICE_TYPE = "const.product.devicetype";
@@ -136,6 +159,7 @@ GnssAbility::GnssAbility() : SystemAbility(LOCATION_GNSS_SA_ID, true)
 #endif
 
     fenceId_ = 0;
+    geofenceRequestFilePath_ = GEOFENCE_REQUEST_FILE_PATH;
     auto agnssNiManager = AGnssNiManager::GetInstance();
     if (agnssNiManager != nullptr) {
         agnssNiManager->SubscribeSaStatusChangeListerner();
@@ -310,7 +334,7 @@ bool GnssAbility::CheckIfGnssConnecting()
 bool GnssAbility::IsGnssfenceRequestExist()
 {
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-    return gnssGeofenceRequestList_.size() != 0;
+    return gnssGeofenceRequestMap_.size() != 0;
 }
 
 LocationErrCode GnssAbility::RefrashRequirements()
@@ -320,9 +344,9 @@ LocationErrCode GnssAbility::RefrashRequirements()
 }
 
 LocationErrCode GnssAbility::RegisterGnssStatusCallback(const sptr<IRemoteObject>& callback,
-    AppIdentity &identity)
+    AppIdentity &identity, int32_t minIntervalMs)
 {
-    if (callback == nullptr) {
+    if (callback == nullptr || minIntervalMs < 0) {
         LBSLOGE(GNSS, "register an invalid gnssStatus callback");
         return LOCATION_ERRCODE_INVALID_PARAM;
     }
@@ -331,7 +355,10 @@ LocationErrCode GnssAbility::RegisterGnssStatusCallback(const sptr<IRemoteObject
         sptr<IRemoteObject::DeathRecipient> death(new (std::nothrow) GnssStatusCallbackDeathRecipient());
         callback->AddDeathRecipient(death);
         gnssStatusDeathMap_[callback] = death;
-        gnssStatusCallbackMap_[callback] = identity;
+        GnssCallbackSubscriber subscriber;
+        subscriber.identity = identity;
+        subscriber.minIntervalMs = minIntervalMs;
+        gnssStatusCallbackMap_[callback] = subscriber;
     } else {
         LBSLOGE(GNSS, "RegisterGnssStatusCallback num max");
         return ERRCODE_SERVICE_UNAVAILABLE;
@@ -363,9 +390,9 @@ LocationErrCode GnssAbility::UnregisterGnssStatusCallback(const sptr<IRemoteObje
 }
 
 LocationErrCode GnssAbility::RegisterNmeaMessageCallback(const sptr<IRemoteObject>& callback,
-    AppIdentity &identity)
+    AppIdentity &identity, int32_t minIntervalMs)
 {
-    if (callback == nullptr) {
+    if (callback == nullptr || minIntervalMs < 0) {
         LBSLOGE(GNSS, "register an invalid nmea callback");
         return LOCATION_ERRCODE_INVALID_PARAM;
     }
@@ -374,7 +401,10 @@ LocationErrCode GnssAbility::RegisterNmeaMessageCallback(const sptr<IRemoteObjec
         sptr<IRemoteObject::DeathRecipient> death(new (std::nothrow) NmeaCallbackDeathRecipient());
         callback->AddDeathRecipient(death);
         nmeaDeathMap_[callback] = death;
-        nmeaCallbackMap_[callback] = identity;
+        GnssCallbackSubscriber subscriber;
+        subscriber.identity = identity;
+        subscriber.minIntervalMs = minIntervalMs;
+        nmeaCallbackMap_[callback] = subscriber;
     } else {
         LBSLOGE(GNSS, "RegisterNmeaMessageCallback num max");
         return ERRCODE_SERVICE_UNAVAILABLE;
@@ -477,38 +507,27 @@ LocationErrCode GnssAbility::UnregisterCachedCallback(const sptr<IRemoteObject>&
 void GnssAbility::RequestRecord(WorkRecord &workRecord, bool isAdded)
 {
     LBSLOGD(GNSS, "enter RequestRecord");
+    UpdateFixInterval();
     if (!IsSupportGps()) {
         LBSLOGI(GNSS, "Is Not Support Gps");
         return;
     }
     if (isAdded) {
         int gnssEnableState  = LocationConfigManager::GetInstance()->GetGnssEnableState();
-        uint32_t tokenId = workRecord.GetTokenId(0);
-        uint32_t firstTokenId = workRecord.GetFirstTokenId(0);
-        bool ignoredSwitchPermission = PermissionManager::CheckLocationSwitchIgnoredPermission(tokenId, firstTokenId);
-        if (!gnssEnableState && !ignoredSwitchPermission) {
+        if (!gnssEnableState && !IsSwitchIgnoredInRecord(workRecord)) {
             LBSLOGE(GNSS, "gnss enablestate false!");
             return;
         }
-        if (!CheckIfHdiConnected()) {
-            auto startTime = CommonUtils::GetCurrentTimeStamp();
-            auto ret = false;
-#ifndef TDD_CASES_ENABLED
-            ret = ConnectHdi();
-#endif
-            auto endTime = CommonUtils::GetCurrentTimeStamp();
-            WriteLocationInnerEvent(HDI_EVENT, {"ret", std::to_string(ret), "type", "ConnectHdi",
-                    "startTime", std::to_string(startTime), "endTime", std::to_string(endTime)});
+        // the hdi is only touched on a real transition, a running session already serves the added requests
+        if (gnssWorkingStatus_.load() != GNSS_WORKING_STATUS_SESSION_BEGIN) {
+            StartGnssSession();
+        }
+        for (int i = 0; i < workRecord.Size(); i++) {
+            LocatorRequestStruct locatorRequestStruct;
+            locatorRequestStruct.bundleName = workRecord.GetName(i);
+            HookUtils::ExecuteHook(LocationProcessStage::GNSS_REQUEST_RECORD_PROCESS,
+                (void *)&locatorRequestStruct, nullptr);
         }
-        EnableGnss();
-#ifdef HDF_DRIVERS_INTERFACE_AGNSS_ENABLE
-        SetAgnssServer();
-#endif
-        StartGnss();
-        LocatorRequestStruct locatorRequestStruct;
-        locatorRequestStruct.bundleName = workRecord.GetName(0);
-        LocationErrCode errorCode = HookUtils::ExecuteHook(LocationProcessStage::GNSS_REQUEST_RECORD_PROCESS,
-            (void *)&locatorRequestStruct, nullptr);
     } else {
         // GNSS will stop only if all requests have stopped
         if (GetRequestNum() == 0) {
@@ -520,7 +539,52 @@ void GnssAbility::RequestRecord(WorkRecord &workRecord, bool isAdded)
         }
     }
     std::string state = isAdded ? "start" : "stop";
-    WriteGnssStateEvent(state, workRecord.GetPid(0), workRecord.GetUid(0));
+    for (int i = 0; i < workRecord.Size(); i++) {
+        WriteGnssStateEvent(state, workRecord.GetPid(i), workRecord.GetUid(i));
+    }
+}
+
+void GnssAbility::StartGnssSession()
+{
+    if (!CheckIfHdiConnected()) {
+        auto startTime = CommonUtils::GetCurrentTimeStamp();
+        auto ret = false;
+#ifndef TDD_CASES_ENABLED
+        ret = ConnectHdi();
+#endif
+        auto endTime = CommonUtils::GetCurrentTimeStamp();
+        WriteLocationInnerEvent(HDI_EVENT, {"ret", std::to_string(ret), "type", "ConnectHdi",
+                "startTime", std::to_string(startTime), "endTime", std::to_string(endTime)});
+    }
+    EnableGnss();
+#ifdef HDF_DRIVERS_INTERFACE_AGNSS_ENABLE
+    SetAgnssServer();
+#endif
+    StartGnss();
+}
+
+bool GnssAbility::IsLocationRequestSuperseded(int64_t requestSeq)
+{
+    // records sent without a sequence are always applied
+    return requestSeq != 0 && requestSeq < locationRequestSeq_.load();
+}
+
+void GnssAbility::UpdateLocationRequestSeq(int64_t requestSeq)
+{
+    int64_t latestSeq = locationRequestSeq_.load();
+    while (latestSeq < requestSeq && !locationRequestSeq_.compare_exchange_weak(latestSeq, requestSeq)) {
+    }
+}
+
+bool GnssAbility::IsSwitchIgnoredInRecord(WorkRecord &workRecord)
+{
+    for (int i = 0; i < workRecord.Size(); i++) {
+        if (PermissionManager::CheckLocationSwitchIgnoredPermission(workRecord.GetTokenId(i),
+            workRecord.GetFirstTokenId(i))) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void GnssAbility::SendConnectHdiEvent()
@@ -649,7 +713,11 @@ LocationErrCode GnssAbility::SendCommand(std::unique_ptr<LocationCommand>& comma
 
 LocationErrCode GnssAbility::SetPositionMode()
 {
-    sptr<IGnssInterface> gnssInterface = IGnssInterface::Get();
+    return SetPositionMode(GetGnssInterface());
+}
+
+LocationErrCode GnssAbility::SetPositionMode(const sptr<IGnssInterface>& gnssInterface)
+{
     if (gnssInterface == nullptr) {
         LBSLOGE(GNSS, "gnssInterface is nullptr");
         return ERRCODE_SERVICE_UNAVAILABLE;
@@ -663,9 +731,11 @@ LocationErrCode GnssAbility::SetPositionMode()
     } else if (suplMode == MODE_MS_ASSISTED) {
         para.gnssBasic.gnssMode = GnssWorkingMode::GNSS_WORKING_MODE_MS_ASSISTED;
     } else {
-        LBSLOGE(GNSS, "unknow mode");
-        return ERRCODE_SUCCESS;
+        // the fix interval has to reach the hdi even when no supl mode is configured on the device
+        LBSLOGE(GNSS, "unknow mode %{public}d, use standalone", suplMode);
+        para.gnssBasic.gnssMode = GnssWorkingMode::GNSS_WORKING_MODE_STANDALONE;
     }
+    para.gnssBasic.minInterval = static_cast<uint32_t>(fixInterval_);
     int ret = gnssInterface->SetGnssConfigPara(para);
     if (ret != ERRCODE_SUCCESS) {
         LBSLOGE(GNSS, "SetGnssConfigPara failed , ret =%{public}d", ret);
@@ -673,6 +743,30 @@ LocationErrCode GnssAbility::SetPositionMode()
     return ERRCODE_SUCCESS;
 }
 
+int64_t GnssAbility::GetFixIntervalByRequest()
+{
+    int minTimeInterval = GetMinTimeInterval();
+    if (minTimeInterval <= 0) {
+        return DEFAULT_FIX_INTERVAL_MS;
+    }
+    return std::min(static_cast<int64_t>(minTimeInterval) * MILLI_PER_SEC, MAX_FIX_INTERVAL_MS);
+}
+
+void GnssAbility::UpdateFixInterval()
+{
+    int64_t fixInterval = GetFixIntervalByRequest();
+    if (fixInterval == fixInterval_) {
+        return;
+    }
+    LBSLOGI(GNSS, "fix interval %{public}s -> %{public}s ms",
+        std::to_string(fixInterval_).c_str(), std::to_string(fixInterval).c_str());
+    fixInterval_ = fixInterval;
+    // a running session picks the new interval up right away, otherwise StartGnss applies it
+    if (GetRequestNum() > 0 && gnssWorkingStatus_.load() == GNSS_WORKING_STATUS_SESSION_BEGIN) {
+        SetPositionMode();
+    }
+}
+
 LocationErrCode GnssAbility::SetCachePositionMode(int reportingPeriodSec, bool wakeUpCacheQueueFull)
 {
     sptr<IGnssInterface> gnssInterface = IGnssInterface::Get();
@@ -753,8 +847,7 @@ void GnssAbility::RestoreGeofenceRequest()
         if (iter->GetWantAgent() == nullptr) {
             {
                 std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-                gnssGeofenceRequestList_.push_back(iter);
-                gnssGeofenceRequestCountMap_[iter->GetBundleName()]++;
+                AddGnssGeofenceRequest(iter);
             }
             AddGnssGeofence(iter);
         } else {
@@ -768,7 +861,12 @@ void GnssAbility::RestoreGeofenceRequest()
         // 初始化fenceId
         InitGeofenceId(fenceId);
     }
-    LBSLOGI(GNSS, "After RestoreGeofenceRequest size %{public}zu", gnssGeofenceRequestList_.size());
+    {
+        // compact the replayed journal, this also migrates files written in the old snapshot format
+        std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
+        SaveGeoFenceRequestToFile();
+    }
+    LBSLOGI(GNSS, "After RestoreGeofenceRequest size %{public}zu", gnssGeofenceRequestMap_.size());
 #endif
 }
 
@@ -1058,10 +1156,9 @@ bool GnssAbility::SaveFenceWantAgentInfo(std::shared_ptr<GeofenceRequest> &reque
         return false;
     }
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-    gnssGeofenceRequestList_.push_back(request);
-    gnssGeofenceRequestCountMap_[request->GetBundleName()]++;
+    AddGnssGeofenceRequest(request);
     LBSLOGI(GNSS, "After SaveFenceWantAgentInfo size %{public}zu",
-        gnssGeofenceRequestList_.size());
+        gnssGeofenceRequestMap_.size());
     return true;
 }
 
@@ -1127,10 +1224,9 @@ bool GnssAbility::RegisterGnssGeofenceCallback(std::shared_ptr<GeofenceRequest>
     callback->AddDeathRecipient(death);
     request->SetTransitionCallbackDeathRecipient(death);
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-    gnssGeofenceRequestList_.push_back(request);
-    gnssGeofenceRequestCountMap_[request->GetBundleName()]++;
+    AddGnssGeofenceRequest(request);
     LBSLOGI(GNSS, "After RegisterGnssGeofenceCallback size %{public}zu",
-        gnssGeofenceRequestList_.size());
+        gnssGeofenceRequestMap_.size());
     return true;
 }
 
@@ -1185,30 +1281,74 @@ LocationErrCode GnssAbility::HandleDeleteGnssGeofence(std::shared_ptr<GeofenceRe
 
 bool GnssAbility::UnregisterGnssGeofenceCallback(int fenceId)
 {
-    for (auto iter = gnssGeofenceRequestList_.begin(); iter != gnssGeofenceRequestList_.end();) {
-        auto gnssGeofenceRequest = *iter;
-        if (gnssGeofenceRequest == nullptr) {
-            iter++;
-            continue;
-        }
-        if (fenceId == gnssGeofenceRequest->GetFenceId()) {
-            if (gnssGeofenceRequest->GetGeofenceTransitionCallback() != nullptr &&
-                gnssGeofenceRequest->GetTransitionCallbackRecipient() != nullptr) {
-                gnssGeofenceRequest->GetGeofenceTransitionCallback()->RemoveDeathRecipient(
-                    gnssGeofenceRequest->GetTransitionCallbackRecipient());
-            }
-            iter = gnssGeofenceRequestList_.erase(iter);
-            ReducedGeoFencesCount(gnssGeofenceRequest->GetBundleName());
-            break;
-        } else {
-            iter++;
-        }
+    auto gnssGeofenceRequest = EraseGnssGeofenceRequest(fenceId);
+    if (gnssGeofenceRequest != nullptr && gnssGeofenceRequest->GetGeofenceTransitionCallback() != nullptr &&
+        gnssGeofenceRequest->GetTransitionCallbackRecipient() != nullptr) {
+        gnssGeofenceRequest->GetGeofenceTransitionCallback()->RemoveDeathRecipient(
+            gnssGeofenceRequest->GetTransitionCallbackRecipient());
     }
     LBSLOGI(GNSS, "After UnregisterGnssGeofenceCallback size:%{public}s",
-        std::to_string(gnssGeofenceRequestList_.size()).c_str());
+        std::to_string(gnssGeofenceRequestMap_.size()).c_str());
     return true;
 }
 
+void GnssAbility::AddGnssGeofenceRequest(const std::shared_ptr<GeofenceRequest>& request)
+{
+    // caller holds gnssGeofenceRequestListMutex_
+    int fenceId = request->GetFenceId();
+    auto oldRequest = EraseGnssGeofenceRequest(fenceId);
+    if (oldRequest != nullptr && oldRequest != request) {
+        LBSLOGE(GNSS, "fenceId:%{public}d is reused, drop the stale request", fenceId);
+        if (oldRequest->GetGeofenceTransitionCallback() != nullptr &&
+            oldRequest->GetTransitionCallbackRecipient() != nullptr) {
+            oldRequest->GetGeofenceTransitionCallback()->RemoveDeathRecipient(
+                oldRequest->GetTransitionCallbackRecipient());
+        }
+    }
+    gnssGeofenceRequestMap_[fenceId] = request;
+    gnssGeofenceRequestCountMap_[request->GetBundleName()]++;
+    BindGnssGeofenceCallback(fenceId, request->GetGeofenceTransitionCallback());
+}
+
+std::shared_ptr<GeofenceRequest> GnssAbility::EraseGnssGeofenceRequest(int fenceId)
+{
+    // caller holds gnssGeofenceRequestListMutex_
+    auto iter = gnssGeofenceRequestMap_.find(fenceId);
+    if (iter == gnssGeofenceRequestMap_.end()) {
+        return nullptr;
+    }
+    auto gnssGeofenceRequest = iter->second;
+    gnssGeofenceRequestMap_.erase(iter);
+    if (gnssGeofenceRequest != nullptr) {
+        UnbindGnssGeofenceCallback(fenceId, gnssGeofenceRequest->GetGeofenceTransitionCallback());
+        ReducedGeoFencesCount(gnssGeofenceRequest->GetBundleName());
+    }
+    return gnssGeofenceRequest;
+}
+
+void GnssAbility::BindGnssGeofenceCallback(int fenceId, const sptr<IRemoteObject>& callback)
+{
+    if (callback == nullptr) {
+        return;
+    }
+    gnssGeofenceCallbackMap_[callback].insert(fenceId);
+}
+
+void GnssAbility::UnbindGnssGeofenceCallback(int fenceId, const sptr<IRemoteObject>& callback)
+{
+    if (callback == nullptr) {
+        return;
+    }
+    auto iter = gnssGeofenceCallbackMap_.find(callback);
+    if (iter == gnssGeofenceCallbackMap_.end()) {
+        return;
+    }
+    iter->second.erase(fenceId);
+    if (iter->second.empty()) {
+        gnssGeofenceCallbackMap_.erase(iter);
+    }
+}
+
 void GnssAbility::ReportFailedOperationResult(std::shared_ptr<GeofenceRequest> &request, GnssGeofenceOperateType type,
     LocationErrCode code)
 {
@@ -1225,37 +1365,35 @@ void GnssAbility::ReportFailedOperationResult(std::shared_ptr<GeofenceRequest> &
 bool GnssAbility::IsDuplicateAddRequestForGnssGeofence(std::shared_ptr<GeofenceRequest>& request)
 {
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-    for (auto iter = gnssGeofenceRequestList_.begin();
-        iter != gnssGeofenceRequestList_.end(); iter++) {
-        auto gnssGeofenceRequest = *iter;
-        if (gnssGeofenceRequest == nullptr) {
-            continue;
-        }
-        if (gnssGeofenceRequest->GetBundleName().compare(request->GetBundleName()) == 0 &&
-            gnssGeofenceRequest->GetFenceId() == request->GetFenceId()) {
-            sptr<IRemoteObject> callback = request->GetGeofenceTransitionCallback();
-            if (callback != nullptr) {
-                gnssGeofenceRequest->SetGeofenceTransitionCallback(callback);
-                sptr<IRemoteObject::DeathRecipient> death(new (std::nothrow) GnssGeofenceCallbackDeathRecipient());
-                callback->AddDeathRecipient(death);
-                gnssGeofenceRequest->SetTransitionCallbackDeathRecipient(death);
-                gnssGeofenceRequest->SetPid(request->GetPid());
-                gnssGeofenceRequest->SetTokenId(request->GetTokenId());
-                gnssGeofenceRequest->SetTokenIdEx(request->GetTokenIdEx());
-                gnssGeofenceRequest->SetFirstTokenId(request->GetFirstTokenId());
-            }
-            return true;
-        }
+    auto iter = gnssGeofenceRequestMap_.find(request->GetFenceId());
+    if (iter == gnssGeofenceRequestMap_.end() || iter->second == nullptr) {
+        return false;
     }
-    return false;
+    auto gnssGeofenceRequest = iter->second;
+    if (gnssGeofenceRequest->GetBundleName().compare(request->GetBundleName()) != 0) {
+        return false;
+    }
+    sptr<IRemoteObject> callback = request->GetGeofenceTransitionCallback();
+    if (callback != nullptr) {
+        UnbindGnssGeofenceCallback(iter->first, gnssGeofenceRequest->GetGeofenceTransitionCallback());
+        gnssGeofenceRequest->SetGeofenceTransitionCallback(callback);
+        BindGnssGeofenceCallback(iter->first, callback);
+        sptr<IRemoteObject::DeathRecipient> death(new (std::nothrow) GnssGeofenceCallbackDeathRecipient());
+        callback->AddDeathRecipient(death);
+        gnssGeofenceRequest->SetTransitionCallbackDeathRecipient(death);
+        gnssGeofenceRequest->SetPid(request->GetPid());
+        gnssGeofenceRequest->SetTokenId(request->GetTokenId());
+        gnssGeofenceRequest->SetTokenIdEx(request->GetTokenIdEx());
+        gnssGeofenceRequest->SetFirstTokenId(request->GetFirstTokenId());
+    }
+    return true;
 }
 
 bool GnssAbility::IsDuplicateOnRequestForGnssGeofence(std::shared_ptr<GeofenceRequest>& request)
 {
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-    for (auto iter = gnssGeofenceRequestList_.begin();
-        iter != gnssGeofenceRequestList_.end(); iter++) {
-        auto gnssGeofenceRequest = *iter;
+    for (auto iter = gnssGeofenceRequestMap_.begin(); iter != gnssGeofenceRequestMap_.end(); iter++) {
+        auto gnssGeofenceRequest = iter->second;
         if (gnssGeofenceRequest == nullptr) {
             continue;
         }
@@ -1275,8 +1413,8 @@ std::vector<std::shared_ptr<GeofenceRequest>> GnssAbility::GetGnssGeofenceReques
     std::vector<std::shared_ptr<GeofenceRequest>> matchedRequests;
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
 
-    for (auto iter = gnssGeofenceRequestList_.begin(); iter != gnssGeofenceRequestList_.end(); iter++) {
-        auto gnssGeofenceRequest = *iter;
+    for (auto iter = gnssGeofenceRequestMap_.begin(); iter != gnssGeofenceRequestMap_.end(); iter++) {
+        auto gnssGeofenceRequest = iter->second;
         if (gnssGeofenceRequest == nullptr) {
             continue;
         }
@@ -1316,28 +1454,27 @@ bool GnssAbility::RemoveGnssGeofenceByCallbackWhenAppDie(sptr<IRemoteObject> cal
     std::vector<std::shared_ptr<GeofenceRequest>> requestList;
     {
         std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-        for (auto iter = gnssGeofenceRequestList_.begin(); iter != gnssGeofenceRequestList_.end();) {
-            auto gnssGeofenceRequest = *iter;
-            if (gnssGeofenceRequest == nullptr) {
-                iter++;
+        auto callbackIter = gnssGeofenceCallbackMap_.find(callbackObj);
+        if (callbackIter == gnssGeofenceCallbackMap_.end()) {
+            return true;
+        }
+        for (int fenceId : callbackIter->second) {
+            auto iter = gnssGeofenceRequestMap_.find(fenceId);
+            if (iter == gnssGeofenceRequestMap_.end() || iter->second == nullptr) {
                 continue;
             }
-            sptr<IRemoteObject> reuestCallback = gnssGeofenceRequest->GetGeofenceTransitionCallback();
-            if (reuestCallback != nullptr && reuestCallback == callbackObj &&
-                gnssGeofenceRequest->GetTransitionCallbackRecipient() != nullptr) {
-                gnssGeofenceRequest->GetGeofenceTransitionCallback()->RemoveDeathRecipient(
-                    gnssGeofenceRequest->GetTransitionCallbackRecipient());
+            auto gnssGeofenceRequest = iter->second;
+            if (gnssGeofenceRequest->GetTransitionCallbackRecipient() == nullptr) {
+                continue;
+            }
+            callbackObj->RemoveDeathRecipient(gnssGeofenceRequest->GetTransitionCallbackRecipient());
 #ifdef NOTIFICATION_ENABLE
-                auto notificationRequestList = gnssGeofenceRequest->GetNotificationRequestList();
-                if (notificationRequestList.size() == 0 &&
-                    gnssGeofenceRequest->GetFenceExtensionAbilityName().empty()) {
-                    requestList.push_back(gnssGeofenceRequest);
-                }
-#endif
-                break;
-            } else {
-                iter++;
+            auto notificationRequestList = gnssGeofenceRequest->GetNotificationRequestList();
+            if (notificationRequestList.size() == 0 &&
+                gnssGeofenceRequest->GetFenceExtensionAbilityName().empty()) {
+                requestList.push_back(gnssGeofenceRequest);
             }
+#endif
         }
     }
     for (auto& request : requestList) {
@@ -1348,20 +1485,20 @@ bool GnssAbility::RemoveGnssGeofenceByCallbackWhenAppDie(sptr<IRemoteObject> cal
         }
     }
     LBSLOGD(GNSS, "After RemoveGnssGeofenceByCallbackWhenAppDie size:%{public}s",
-        std::to_string(gnssGeofenceRequestList_.size()).c_str());
+        std::to_string(gnssGeofenceRequestMap_.size()).c_str());
     return true;
 }
 
 size_t GnssAbility::GetGnssGeofenceRequestMapSize()
 {
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-    return gnssGeofenceRequestList_.size();
+    return gnssGeofenceRequestMap_.size();
 }
 
 size_t GnssAbility::GetTotalGnssFenceCount()
 {
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-    return gnssGeofenceRequestList_.size() + FusionFenceAbility::GetInstance()->GetGnssFenceCount();
+    return gnssGeofenceRequestMap_.size() + FusionFenceAbility::GetInstance()->GetGnssFenceCount();
 }
  
 int GnssAbility::GetGnssFenceCountForOneApp(const std::string& bundleName)
@@ -1412,24 +1549,14 @@ void GnssAbility::ReportGeofenceOperationResult(int fenceId, int type, int resul
         LBSLOGE(GNSS, "request is nullptr");
         return;
     }
+    bool isRemoved = false;
     if (type == static_cast<int>(HDI::Location::Geofence::V2_0::TYPE_DELETE) &&
         result == static_cast<int>(HDI::Location::Geofence::V2_0::GEOFENCE_OPERATION_SUCCESS)) {
         UnregisterGnssGeofenceCallback(fenceId);
+        isRemoved = true;
     }
-    bool needSaveToFile = false;
-#ifdef NOTIFICATION_ENABLE
-    if (geofenceRequest->GetNotificationRequestList().size() != 0) {
-        needSaveToFile = true;
-    }
-#endif
-    if (geofenceRequest->GetWantAgent() != nullptr) {
-        needSaveToFile = true;
-    }
-    if (!geofenceRequest->GetFenceExtensionAbilityName().empty()) {
-        needSaveToFile = true;
-    }
-    if (needSaveToFile) {
-        SaveGeoFenceRequestToFile();
+    if (IsGeofenceRequestNeedSave(geofenceRequest)) {
+        AppendGeoFenceRequestToFile(geofenceRequest, isRemoved);
     }
     auto callback = geofenceRequest->GetGeofenceTransitionCallback();
     if (callback == nullptr) {
@@ -1445,13 +1572,88 @@ void GnssAbility::ReportGeofenceOperationResult(int fenceId, int type, int resul
     gnssGeofenceCallback->OnReportOperationResult(fenceId, type, result);
 }
 
+bool GnssAbility::IsGeofenceRequestNeedSave(const std::shared_ptr<GeofenceRequest>& request)
+{
+    if (request == nullptr) {
+        return false;
+    }
+#ifdef NOTIFICATION_ENABLE
+    if (request->GetNotificationRequestList().size() != 0) {
+        return true;
+    }
+#endif
+    return request->GetWantAgent() != nullptr || !request->GetFenceExtensionAbilityName().empty();
+}
+
 std::vector<std::shared_ptr<GeofenceRequest>> GnssAbility::ReadGeoFenceRequestFromFile()
 {
     std::vector<std::shared_ptr<GeofenceRequest>> requestList;
-    // 读取文件内容
+    if (!CommonUtils::IsExistFile(geofenceRequestFilePath_)) {
+        return requestList;
+    }
+    std::ifstream fs(geofenceRequestFilePath_);
+    if (!fs.is_open()) {
+        LBSLOGE(GNSS, "fs.is_open false, return");
+        return requestList;
+    }
+    // replay the journal in one pass, a later record of the same fence overrides the earlier ones
+    std::map<int, std::shared_ptr<GeofenceRequest>> requestMap;
+    std::string record;
+    bool isFirstRecord = true;
+    while (std::getline(fs, record)) {
+        if (record.empty()) {
+            continue;
+        }
+        bool isJournalRecord = record[0] == GEOFENCE_JOURNAL_ADD || record[0] == GEOFENCE_JOURNAL_REMOVE;
+        if (isFirstRecord && !isJournalRecord) {
+            // only the first record tells the formats apart, a damaged record later on must not hide the others
+            fs.close();
+            return ReadLegacyGeoFenceRequestFromFile();
+        }
+        isFirstRecord = false;
+        if (fs.eof()) {
+            // only newline terminated records are complete, the tail may be torn by a crash while appending
+            LBSLOGE(GNSS, "drop the unterminated geofence journal record");
+            break;
+        }
+        if (!isJournalRecord) {
+            LBSLOGE(GNSS, "drop the unknown geofence journal record");
+            continue;
+        }
+        if (record[0] == GEOFENCE_JOURNAL_REMOVE) {
+            char* end = nullptr;
+            long fenceId = std::strtol(record.c_str() + 1, &end, 10);
+            if (end == record.c_str() + 1 || *end != '\0') {
+                LBSLOGE(GNSS, "drop the invalid geofence journal record");
+                continue;
+            }
+            requestMap.erase(static_cast<int>(fenceId));
+            continue;
+        }
+        // 第三个参数 false 表示不抛出异常
+        nlohmann::json jsonObj = nlohmann::json::parse(record.begin() + 1, record.end(), nullptr, false);
+        if (jsonObj.is_discarded()) {
+            LBSLOGE(GNSS, "drop the invalid geofence journal record");
+            continue;
+        }
+        std::shared_ptr<GeofenceRequest> request = GeofenceRequest::FromJson(jsonObj);
+        if (request != nullptr) {
+            requestMap[request->GetFenceId()] = request;
+        }
+    }
+    fs.close();
+    for (auto& iter : requestMap) {
+        requestList.push_back(iter.second);
+    }
+    return requestList;
+}
+
+std::vector<std::shared_ptr<GeofenceRequest>> GnssAbility::ReadLegacyGeoFenceRequestFromFile()
+{
+    // files written before the journal hold one object of {fenceId: request json string}
+    std::vector<std::shared_ptr<GeofenceRequest>> requestList;
     std::string fileContent = ReadFileContent();
-    // 验证 JSON 字符串是否有效
-    if (fileContent.empty() || !nlohmann::json::accept(fileContent)) {
+    if (fileContent.empty()) {
         return requestList;
     }
     auto *geofenceRequestRoot = cJSON_Parse(fileContent.c_str());
@@ -1460,9 +1662,7 @@ std::vector<std::shared_ptr<GeofenceRequest>> GnssAbility::ReadGeoFenceRequestFr
     }
     cJSON *item = NULL;
     cJSON_ArrayForEach(item, geofenceRequestRoot) {
-        const char *key = item->string;
-        cJSON *value = cJSON_GetObjectItemCaseSensitive(geofenceRequestRoot, key);
-        if (!cJSON_IsString(value)) {
+        if (!cJSON_IsString(item)) {
             cJSON_Delete(geofenceRequestRoot);
             return requestList;
         }
@@ -1480,15 +1680,16 @@ std::vector<std::shared_ptr<GeofenceRequest>> GnssAbility::ReadGeoFenceRequestFr
         }
     }
     cJSON_Delete(geofenceRequestRoot);
+    LBSLOGI(GNSS, "read %{public}zu geofence requests from the legacy file", requestList.size());
     return requestList;
 }
 
 std::string GnssAbility::ReadFileContent()
 {
-    if (!CommonUtils::IsExistFile(GEOFENCE_REQUEST_FILE_PATH)) {
+    if (!CommonUtils::IsExistFile(geofenceRequestFilePath_)) {
         return "";
     }
-    std::ifstream fs(GEOFENCE_REQUEST_FILE_PATH);
+    std::ifstream fs(geofenceRequestFilePath_);
     if (!fs.is_open()) {
         LBSLOGE(GNSS, "fs.is_open false, return");
         return "";
@@ -1504,33 +1705,132 @@ std::string GnssAbility::ReadFileContent()
     return line;
 }
 
-void GnssAbility::SaveGeoFenceRequestToFile()
+void GnssAbility::AppendGeoFenceRequestToFile(const std::shared_ptr<GeofenceRequest>& request, bool isRemoved)
+{
+    // caller holds gnssGeofenceRequestListMutex_, gnssGeofenceRequestMap_ already reflects this operation
+    if (geofenceJournalRecordNum_ >= std::max(GEOFENCE_JOURNAL_COMPACT_MIN_RECORD_NUM, geofenceJournalLiveNum_)) {
+        SaveGeoFenceRequestToFile();
+        return;
+    }
+    int fd = open(geofenceRequestFilePath_.c_str(), O_RDWR | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        LBSLOGE(GNSS, "open geofence journal failed, return");
+        return;
+    }
+    if (!TrimGeoFenceJournalTail(fd)) {
+        // the journal can not be appended to safely, rewrite it from the fences in memory
+        close(fd);
+        SaveGeoFenceRequestToFile();
+        return;
+    }
+    std::string record;
+    if (isRemoved) {
+        record = GEOFENCE_JOURNAL_REMOVE + std::to_string(request->GetFenceId());
+    } else {
+        nlohmann::json jsonObject;
+        request->ToJson(jsonObject);
+        record = GEOFENCE_JOURNAL_ADD + jsonObject.dump();
+    }
+    record += '\n';
+    bool isWritten = write(fd, record.c_str(), record.size()) == static_cast<ssize_t>(record.size()) &&
+        fsync(fd) == 0;
+    close(fd);
+    if (!isWritten) {
+        LBSLOGE(GNSS, "append geofence journal failed");
+        return;
+    }
+    geofenceJournalRecordNum_++;
+}
+
+bool GnssAbility::TrimGeoFenceJournalTail(int fd)
 {
-    if (!CommonUtils::IsExistFile(GEOFENCE_REQUEST_FILE_PATH)) {
-        CommonUtils::CreateFile(GEOFENCE_REQUEST_FILE_PATH, "0");
+    off_t size = lseek(fd, 0, SEEK_END);
+    if (size <= 0) {
+        return size == 0;
+    }
+    char head = '\0';
+    if (pread(fd, &head, 1, 0) != 1 || (head != GEOFENCE_JOURNAL_ADD && head != GEOFENCE_JOURNAL_REMOVE)) {
+        // not written as a journal, e.g. a legacy snapshot left over by a failed migration
+        return false;
     }
-    std::ofstream fs(GEOFENCE_REQUEST_FILE_PATH, std::ofstream::out | std::ofstream::trunc);
+    // a record torn by a crash has no trailing newline, cut it off so the next record starts on its own line
+    char buf[GEOFENCE_JOURNAL_TAIL_SCAN_SIZE];
+    off_t end = size;
+    while (end > 0) {
+        off_t begin = std::max(static_cast<off_t>(0), end - static_cast<off_t>(sizeof(buf)));
+        ssize_t len = end - begin;
+        if (pread(fd, buf, len, begin) != len) {
+            return false;
+        }
+        for (ssize_t i = len - 1; i >= 0; i--) {
+            if (buf[i] != '\n') {
+                continue;
+            }
+            off_t validSize = begin + i + 1;
+            if (validSize == size) {
+                return true;
+            }
+            LBSLOGE(GNSS, "truncate the unterminated geofence journal record");
+            return ftruncate(fd, validSize) == 0;
+        }
+        end = begin;
+    }
+    return false;
+}
+
+bool GnssAbility::SyncGeoFenceRequestFile(const std::string& filePath, int flags)
+{
+    int fd = open(filePath.c_str(), flags);
+    if (fd < 0) {
+        return false;
+    }
+    bool isSynced = fsync(fd) == 0;
+    close(fd);
+    return isSynced;
+}
+
+void GnssAbility::SaveGeoFenceRequestToFile()
+{
+    // caller holds gnssGeofenceRequestListMutex_, the snapshot is renamed over the journal once complete
+    // so a crash while compacting leaves the previous journal intact
+    std::string tmpFilePath = geofenceRequestFilePath_ + GEOFENCE_REQUEST_TMP_FILE_SUFFIX;
+    std::ofstream fs(tmpFilePath, std::ofstream::out | std::ofstream::trunc);
     if (!fs || !fs.is_open()) {
         LBSLOGE(GNSS, "fs.is_open false, return");
         return;
     }
-    cJSON *root = cJSON_CreateObject();
-    for (auto gnssGeofenceRequest : gnssGeofenceRequestList_) {
+    int recordNum = 0;
+    for (auto& iter : gnssGeofenceRequestMap_) {
+        // every fence is kept as the snapshot always did, RestoreGeofenceRequest filters the ones without callback
+        auto gnssGeofenceRequest = iter.second;
+        if (gnssGeofenceRequest == nullptr) {
+            continue;
+        }
         nlohmann::json jsonObject;
         gnssGeofenceRequest->ToJson(jsonObject);
-        std::string geoFenceRequestStr = jsonObject.dump();
-        cJSON_AddItemToObject(root, std::to_string(gnssGeofenceRequest->GetFenceId()).c_str(),
-            cJSON_CreateString(geoFenceRequestStr.c_str()));
-    }
-    auto jsonString = cJSON_Print(root);
-    if (jsonString != nullptr) {
-        fs.write(jsonString, strlen(jsonString));
-        cJSON_free(jsonString);
+        std::string record = GEOFENCE_JOURNAL_ADD + jsonObject.dump() + '\n';
+        fs.write(record.c_str(), record.size());
+        recordNum++;
     }
-    cJSON_Delete(root);
-    fs.clear();
+    fs.flush();
+    bool isWritten = fs.good();
     fs.close();
-    return;
+    // the snapshot has to reach the disk before it replaces the journal, the rename is persisted by
+    // syncing the directory that holds both files
+    size_t dirPos = geofenceRequestFilePath_.find_last_of('/');
+    std::string dirPath = dirPos == std::string::npos ? "." : geofenceRequestFilePath_.substr(0, dirPos + 1);
+    if (!isWritten || !SyncGeoFenceRequestFile(tmpFilePath, O_RDONLY) ||
+        !SyncGeoFenceRequestFile(dirPath, O_RDONLY | O_DIRECTORY) ||
+        std::rename(tmpFilePath.c_str(), geofenceRequestFilePath_.c_str()) != 0) {
+        LBSLOGE(GNSS, "compact geofence journal failed");
+        std::remove(tmpFilePath.c_str());
+        return;
+    }
+    if (!SyncGeoFenceRequestFile(dirPath, O_RDONLY | O_DIRECTORY)) {
+        LBSLOGE(GNSS, "sync geofence journal directory failed");
+    }
+    geofenceJournalLiveNum_ = recordNum;
+    geofenceJournalRecordNum_ = 0;
 }
 #endif
 
@@ -1700,14 +2000,9 @@ bool GnssAbility::IsAppBackground(std::string bundleName, uint32_t tokenId, uint
 
 std::shared_ptr<GeofenceRequest> GnssAbility::GetGeofenceRequestByFenceId(int fenceId)
 {
-    for (auto iter = gnssGeofenceRequestList_.begin(); iter != gnssGeofenceRequestList_.end(); iter++) {
-        auto gnssGeofenceRequest = *iter;
-        if (gnssGeofenceRequest == nullptr) {
-            continue;
-        }
-        if (gnssGeofenceRequest->GetFenceId() == fenceId) {
-            return gnssGeofenceRequest;
-        }
+    auto iter = gnssGeofenceRequestMap_.find(fenceId);
+    if (iter != gnssGeofenceRequestMap_.end() && iter->second != nullptr) {
+        return iter->second;
     }
     LBSLOGE(GNSS, "can not get geofence request by fenceId, fenceId:%{public}d",
         fenceId);
@@ -1717,12 +2012,13 @@ std::shared_ptr<GeofenceRequest> GnssAbility::GetGeofenceRequestByFenceId(int fe
 void GnssAbility::DeleteMinExpirationGeofenceRequest(const std::string& packageName)
 {
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-    if (gnssGeofenceRequestList_.empty()) {
+    if (gnssGeofenceRequestMap_.empty()) {
         return;
     }
     std::shared_ptr<GeofenceRequest> minRequest;
     int64_t minTimeStamp = INT64_MAX;
-    for (const auto& request : gnssGeofenceRequestList_) {
+    for (const auto& iter : gnssGeofenceRequestMap_) {
+        auto request = iter.second;
         if (request == nullptr) {
             continue;
         }
@@ -1840,64 +2136,187 @@ void GnssAbility::ReportGnssSessionStatus(int status)
 
 void GnssAbility::ReportCachedLocation(const std::vector<std::unique_ptr<Location>> &cacheLocations)
 {
-    std::unique_lock<ffrt::mutex> lock(batchingMutex_);
-    for (const auto& iter : batchingCallbackMap_) {
-        if (iter.second == nullptr) {
-            continue;
-        }
-        AppIdentity appIdentity = iter.second->appIdentity;
-        if (!PermissionManager::CheckApproximatelyPermission(
-            appIdentity.GetTokenId(), appIdentity.GetFirstTokenId())) {
-            LBSLOGE(GNSS, "ReportCachedLocation CheckApproximatelyPermission return false, tokenId = %{public}d",
-                appIdentity.GetTokenId());
-            continue;
+    // take the eligible callbacks under the lock, the binder calls are made after releasing it
+    std::vector<sptr<ICachedLocationsCallback>> cachedCallbacks;
+    {
+        std::unique_lock<ffrt::mutex> lock(batchingMutex_);
+        for (const auto& iter : batchingCallbackMap_) {
+            if (iter.second == nullptr) {
+                continue;
+            }
+            AppIdentity appIdentity = iter.second->appIdentity;
+            if (!PermissionManager::CheckApproximatelyPermission(
+                appIdentity.GetTokenId(), appIdentity.GetFirstTokenId())) {
+                LBSLOGE(GNSS, "ReportCachedLocation CheckApproximatelyPermission return false, tokenId = %{public}d",
+                    appIdentity.GetTokenId());
+                continue;
+            }
+            sptr<ICachedLocationsCallback> cachedCallback = iface_cast<ICachedLocationsCallback>(iter.first);
+            if (cachedCallback != nullptr) {
+                cachedCallbacks.push_back(cachedCallback);
+            }
         }
-        auto callback = iter.first;
-        sptr<ICachedLocationsCallback> cachedCallback = iface_cast<ICachedLocationsCallback>(callback);
-        if (cachedCallback != nullptr) {
-            cachedCallback->OnCacheLocationsReport(cacheLocations);
+    }
+    for (auto& cachedCallback : cachedCallbacks) {
+        cachedCallback->OnCacheLocationsReport(cacheLocations);
+    }
+}
+
+bool GnssAbility::IsSubscriberDeliverable(GnssCallbackSubscriber& subscriber, const std::string& reportName)
+{
+    uint64_t permissionGeneration = PermissionManager::GetPermissionGeneration();
+    uint64_t accountGeneration = ActiveAccountCache::GetInstance()->GetGeneration();
+    uint64_t freezeGeneration = ProxyFreezeManager::GetInstance()->GetProxyGeneration();
+    int64_t curTime = CommonUtils::GetSinceBootTime() / MILL_TO_NANOS;
+    if (subscriber.checkTime != 0 && subscriber.permissionGeneration == permissionGeneration &&
+        subscriber.accountGeneration == accountGeneration && subscriber.freezeGeneration == freezeGeneration &&
+        curTime - subscriber.checkTime < SUBSCRIBER_RECHECK_INTERVAL_MS) {
+        return subscriber.isDeliverable;
+    }
+    AppIdentity& identity = subscriber.identity;
+    bool isDeliverable = true;
+    if (!PermissionManager::CheckApproximatelyPermission(identity.GetTokenId(), identity.GetFirstTokenId())) {
+        LBSLOGE(GNSS, "%{public}s CheckApproximatelyPermission return false, tokenId = %{public}d",
+            reportName.c_str(), identity.GetTokenId());
+        isDeliverable = false;
+    } else if (!CommonUtils::IsAppBelongCurrentAccount(identity) ||
+        ProxyFreezeManager::GetInstance()->IsProxyPid(identity.GetPid())) {
+        isDeliverable = false;
+    }
+    subscriber.isDeliverable = isDeliverable;
+    subscriber.permissionGeneration = permissionGeneration;
+    subscriber.accountGeneration = accountGeneration;
+    subscriber.freezeGeneration = freezeGeneration;
+    subscriber.checkTime = curTime;
+    return isDeliverable;
+}
+
+bool GnssAbility::CoalesceNmea(GnssCallbackSubscriber& subscriber, int64_t timestamp, const std::string& nmea,
+    int64_t curTime)
+{
+    if (!subscriber.pendingNmea.empty() && subscriber.pendingNmea.back() != '\n') {
+        subscriber.pendingNmea.push_back('\n');
+    }
+    subscriber.pendingNmea.append(nmea);
+    subscriber.pendingNmeaTimestamp = timestamp;
+    if (curTime - subscriber.lastDeliverTime < subscriber.minIntervalMs &&
+        subscriber.pendingNmea.size() < MAX_PENDING_NMEA_SIZE) {
+        return false;
+    }
+    subscriber.lastDeliverTime = curTime;
+    return true;
+}
+
+void GnssAbility::ScheduleNmeaFlush(int64_t flushTime, int64_t curTime)
+{
+    // called with nmeaMutex_ held, only the earliest flush is armed and it arms the next one when it fires
+    if (gnssHandler_ == nullptr || (nmeaFlushTime_ != 0 && nmeaFlushTime_ <= flushTime)) {
+        return;
+    }
+    nmeaFlushTime_ = flushTime;
+    gnssHandler_->RemoveEvent(static_cast<uint32_t>(GnssAbilityInterfaceCode::FLUSH_NMEA));
+    AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(
+        static_cast<uint32_t>(GnssAbilityInterfaceCode::FLUSH_NMEA), 0);
+    gnssHandler_->SendEvent(event, std::max(flushTime - curTime, static_cast<int64_t>(0)));
+}
+
+void GnssAbility::FlushPendingNmea(bool isForced)
+{
+    std::vector<std::tuple<sptr<INmeaMessageCallback>, int64_t, std::string>> flushedNmeas;
+    {
+        std::unique_lock<ffrt::mutex> lock(nmeaMutex_);
+        int64_t curTime = CommonUtils::GetSinceBootTime() / MILL_TO_NANOS;
+        nmeaFlushTime_ = 0;
+        for (auto& pair : nmeaCallbackMap_) {
+            GnssCallbackSubscriber& subscriber = pair.second;
+            if (subscriber.pendingNmea.empty()) {
+                continue;
+            }
+            int64_t flushTime = subscriber.lastDeliverTime + subscriber.minIntervalMs;
+            if (!isForced && flushTime > curTime) {
+                ScheduleNmeaFlush(flushTime, curTime);
+                continue;
+            }
+            std::string pendingNmea = std::move(subscriber.pendingNmea);
+            subscriber.pendingNmea.clear();
+            subscriber.lastDeliverTime = curTime;
+            sptr<INmeaMessageCallback> nmeaCallback = iface_cast<INmeaMessageCallback>(pair.first);
+            if (nmeaCallback == nullptr || !IsSubscriberDeliverable(subscriber, "FlushPendingNmea")) {
+                continue;
+            }
+            flushedNmeas.emplace_back(nmeaCallback, subscriber.pendingNmeaTimestamp, std::move(pendingNmea));
         }
     }
+    for (auto& flushedNmea : flushedNmeas) {
+        std::get<0>(flushedNmea)->OnMessageChange(std::get<1>(flushedNmea), std::get<2>(flushedNmea));
+    }
 }
 
 void GnssAbility::ReportNmea(int64_t timestamp, const std::string &nmea)
 {
-    std::unique_lock<ffrt::mutex> lock(nmeaMutex_);
-    for (const auto& pair : nmeaCallbackMap_) {
-        auto callback = pair.first;
-        sptr<INmeaMessageCallback> nmeaCallback = iface_cast<INmeaMessageCallback>(callback);
-        AppIdentity nmeaIdentity = pair.second;
-        if (!PermissionManager::CheckApproximatelyPermission(
-            nmeaIdentity.GetTokenId(), nmeaIdentity.GetFirstTokenId())) {
-            LBSLOGE(GNSS, "ReportNmea CheckApproximatelyPermission return false, tokenId = %{public}d",
-                nmeaIdentity.GetTokenId());
-            continue;
-        }
-        if (CommonUtils::IsAppBelongCurrentAccount(nmeaIdentity) &&
-            !ProxyFreezeManager::GetInstance()->IsProxyPid(nmeaIdentity.GetPid())) {
-            nmeaCallback->OnMessageChange(timestamp, nmea);
+    // take the eligible callbacks under the lock, the binder calls are made after releasing it
+    std::vector<sptr<INmeaMessageCallback>> nmeaCallbacks;
+    std::vector<std::pair<sptr<INmeaMessageCallback>, std::string>> coalescedNmeas;
+    {
+        std::unique_lock<ffrt::mutex> lock(nmeaMutex_);
+        int64_t curTime = CommonUtils::GetSinceBootTime() / MILL_TO_NANOS;
+        nmeaCallbacks.reserve(nmeaCallbackMap_.size());
+        for (auto& pair : nmeaCallbackMap_) {
+            GnssCallbackSubscriber& subscriber = pair.second;
+            if (!IsSubscriberDeliverable(subscriber, "ReportNmea")) {
+                continue;
+            }
+            sptr<INmeaMessageCallback> nmeaCallback = iface_cast<INmeaMessageCallback>(pair.first);
+            if (nmeaCallback == nullptr) {
+                continue;
+            }
+            if (subscriber.minIntervalMs == 0) {
+                nmeaCallbacks.push_back(nmeaCallback);
+            } else if (CoalesceNmea(subscriber, timestamp, nmea, curTime)) {
+                coalescedNmeas.emplace_back(nmeaCallback, std::move(subscriber.pendingNmea));
+                subscriber.pendingNmea.clear();
+            } else {
+                // the held sentences must not wait for a next sentence, the stream may stop here
+                ScheduleNmeaFlush(subscriber.lastDeliverTime + subscriber.minIntervalMs, curTime);
+            }
         }
     }
+    for (auto& nmeaCallback : nmeaCallbacks) {
+        nmeaCallback->OnMessageChange(timestamp, nmea);
+    }
+    for (auto& coalescedNmea : coalescedNmeas) {
+        coalescedNmea.first->OnMessageChange(timestamp, coalescedNmea.second);
+    }
 }
 
 void GnssAbility::ReportSv(const std::unique_ptr<SatelliteStatus> &sv)
 {
-    std::unique_lock<ffrt::mutex> lock(gnssMutex_);
-    for (const auto& pair : gnssStatusCallbackMap_) {
-        auto callback = pair.first;
-        sptr<IGnssStatusCallback> gnssStatusCallback = iface_cast<IGnssStatusCallback>(callback);
-        AppIdentity gnssStatusIdentity = pair.second;
-        if (!PermissionManager::CheckApproximatelyPermission(
-            gnssStatusIdentity.GetTokenId(), gnssStatusIdentity.GetFirstTokenId())) {
-            LBSLOGE(GNSS, "ReportSv CheckApproximatelyPermission return false, tokenId = %{public}d",
-                gnssStatusIdentity.GetTokenId());
-            continue;
-        }
-        if (CommonUtils::IsAppBelongCurrentAccount(gnssStatusIdentity) &&
-            !ProxyFreezeManager::GetInstance()->IsProxyPid(gnssStatusIdentity.GetPid())) {
-            gnssStatusCallback->OnStatusChange(sv);
+    std::vector<sptr<IGnssStatusCallback>> gnssStatusCallbacks;
+    {
+        std::unique_lock<ffrt::mutex> lock(gnssMutex_);
+        int64_t curTime = CommonUtils::GetSinceBootTime() / MILL_TO_NANOS;
+        gnssStatusCallbacks.reserve(gnssStatusCallbackMap_.size());
+        for (auto& pair : gnssStatusCallbackMap_) {
+            GnssCallbackSubscriber& subscriber = pair.second;
+            if (!IsSubscriberDeliverable(subscriber, "ReportSv")) {
+                continue;
+            }
+            // every status is a full snapshot, so a coalesced subscriber only needs the latest one
+            if (subscriber.minIntervalMs > 0) {
+                if (curTime - subscriber.lastDeliverTime < subscriber.minIntervalMs) {
+                    continue;
+                }
+                subscriber.lastDeliverTime = curTime;
+            }
+            sptr<IGnssStatusCallback> gnssStatusCallback = iface_cast<IGnssStatusCallback>(pair.first);
+            if (gnssStatusCallback != nullptr) {
+                gnssStatusCallbacks.push_back(gnssStatusCallback);
+            }
         }
     }
+    for (auto& gnssStatusCallback : gnssStatusCallbacks) {
+        gnssStatusCallback->OnStatusChange(sv);
+    }
 }
 
 bool GnssAbility::IsSupportGps()
@@ -1925,7 +2344,7 @@ bool GnssAbility::EnableGnss()
         LBSLOGE(GNSS, "QuerySwitchState is DISABLED");
         return false;
     }
-    sptr<IGnssInterface> gnssInterface = IGnssInterface::Get();
+    sptr<IGnssInterface> gnssInterface = GetGnssInterface();
     if (gnssInterface == nullptr) {
         LBSLOGE(GNSS, "gnssInterface is nullptr");
         return false;
@@ -1959,7 +2378,7 @@ bool GnssAbility::EnableGnss()
 
 void GnssAbility::DisableGnss()
 {
-    sptr<IGnssInterface> gnssInterface = IGnssInterface::Get();
+    sptr<IGnssInterface> gnssInterface = GetGnssInterface();
     if (gnssInterface == nullptr) {
         LBSLOGE(GNSS, "gnssInterface is nullptr");
         return;
@@ -1987,6 +2406,23 @@ bool GnssAbility::IsGnssEnabled()
 void GnssAbility::RestGnssWorkStatus()
 {
     gnssWorkingStatus_.store(GNSS_WORKING_STATUS_NONE);
+    ResetGnssInterface();
+}
+
+sptr<IGnssInterface> GnssAbility::GetGnssInterface()
+{
+    // the lookup goes through the hdi service manager, so keep the interface until the hdi reconnects
+    std::unique_lock<ffrt::mutex> lock(gnssInterfaceMutex_);
+    if (gnssInterface_ == nullptr) {
+        gnssInterface_ = IGnssInterface::Get();
+    }
+    return gnssInterface_;
+}
+
+void GnssAbility::ResetGnssInterface()
+{
+    std::unique_lock<ffrt::mutex> lock(gnssInterfaceMutex_);
+    gnssInterface_ = nullptr;
 }
 
 bool GnssAbility::IsGnssBatchingEnabled()
@@ -2013,7 +2449,7 @@ void GnssAbility::StartGnss()
         return;
     }
 
-    sptr<IGnssInterface> gnssInterface = IGnssInterface::Get();
+    sptr<IGnssInterface> gnssInterface = GetGnssInterface();
     if (gnssInterface == nullptr) {
         LBSLOGE(GNSS, "gnssInterface is nullptr");
         return;
@@ -2047,7 +2483,9 @@ void GnssAbility::StartGnss()
 
 void GnssAbility::StopGnss()
 {
-    sptr<IGnssInterface> gnssInterface = IGnssInterface::Get();
+    // the sentences held for coalesced subscribers belong to the session that stops here
+    FlushPendingNmea(true);
+    sptr<IGnssInterface> gnssInterface = GetGnssInterface();
     if (gnssInterface == nullptr) {
         LBSLOGE(GNSS, "gnssInterface is nullptr");
         return;
@@ -2061,6 +2499,7 @@ void GnssAbility::StopGnss()
     if (ret == 0) {
         gnssWorkingStatus_.store(GNSS_WORKING_STATUS_SESSION_END);
         WriteLocationInnerEvent(STOP_GNSS, {});
+        GnssInnerEventAggregator::GetInstance()->Flush();
     } else {
         WriteLocationInnerEvent(HDI_EVENT, {"errCode", std::to_string(ret), "hdiName", "StopGnss", "hdiType", "gnss"});
     }
@@ -2253,6 +2692,7 @@ bool GnssAbility::ConnectGnssHdi()
             return false;
         }
     }
+    ResetGnssInterface();
     sptr<IGnssInterface> gnssInterface = IGnssInterface::Get();
     if (gnssInterface == nullptr) {
         LBSLOGE(GNSS, "gnssInterface get failed");
@@ -2355,6 +2795,7 @@ bool GnssAbility::RemoveHdi()
         return false;
     }
     gnssCallback_ = nullptr;
+    ResetGnssInterface();
 #ifdef HDF_DRIVERS_INTERFACE_AGNSS_ENABLE
     if (devmgr->UnloadDevice(AGNSS_SERVICE_NAME) != 0) {
         LBSLOGE(GNSS, "Unload agnss service failed!");
@@ -2562,8 +3003,8 @@ LocationErrCode GnssAbility::GetActiveGeoFences(std::string bundleName,
         return LOCATION_ERRCODE_NOT_SUPPORTED;
     }
     std::unique_lock<ffrt::mutex> lock(gnssGeofenceRequestListMutex_);
-    for (auto iter = gnssGeofenceRequestList_.begin(); iter != gnssGeofenceRequestList_.end(); iter++) {
-        auto request = *iter;
+    for (auto iter = gnssGeofenceRequestMap_.begin(); iter != gnssGeofenceRequestMap_.end(); iter++) {
+        auto request = iter->second;
         if (request == nullptr) {
             continue;
         }
@@ -2642,9 +3083,13 @@ void GnssAbility::SendMessage(uint32_t code, MessageParcel &data, MessageParcel
     switch (code) {
         case static_cast<uint32_t>(GnssInterfaceCode::SEND_LOCATION_REQUEST): {
             std::unique_ptr<WorkRecord> workrecord = WorkRecord::Unmarshalling(data);
+            // the sequence only moves once the record is queued, a failed send must not supersede the queued one
+            int64_t requestSeq = locationRequestSeq_.load() + 1;
             AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::
-                Get(code, workrecord);
-            SendEvent(event, reply);
+                Get(code, workrecord, requestSeq);
+            if (SendEvent(event, reply)) {
+                UpdateLocationRequestSeq(requestSeq);
+            }
             break;
         }
         case static_cast<uint32_t>(GnssInterfaceCode::SET_MOCKED_LOCATIONS): {
@@ -2726,17 +3171,18 @@ void GnssAbility::SendFusionFenceMessage(uint32_t code, MessageParcel &data, Mes
     SendEvent(event, reply);
 }
 
-void GnssAbility::SendEvent(AppExecFwk::InnerEvent::Pointer& event, MessageParcel &reply)
+bool GnssAbility::SendEvent(AppExecFwk::InnerEvent::Pointer& event, MessageParcel &reply)
 {
     if (gnssHandler_ == nullptr) {
         reply.WriteInt32(ERRCODE_SERVICE_UNAVAILABLE);
-        return;
+        return false;
     }
     if (gnssHandler_->SendEvent(event)) {
         reply.WriteInt32(ERRCODE_SUCCESS);
-    } else {
-        reply.WriteInt32(ERRCODE_SERVICE_UNAVAILABLE);
+        return true;
     }
+    reply.WriteInt32(ERRCODE_SERVICE_UNAVAILABLE);
+    return false;
 }
 
 void GnssAbility::RegisterLocationHdiDeathRecipient()
@@ -2828,6 +3274,8 @@ void GnssHandler::InitGnssEventProcessMap()
         [this](const AppExecFwk::InnerEvent::Pointer& event) { HandleSendNetworkLocation(event); };
     gnssEventProcessMap_[static_cast<uint32_t>(GnssAbilityInterfaceCode::RESTORE_GEOFENCE_REQUEST)] =
         [this](const AppExecFwk::InnerEvent::Pointer& event) { HandleRestoreGeofenceRequest(event); };
+    gnssEventProcessMap_[static_cast<uint32_t>(GnssAbilityInterfaceCode::FLUSH_NMEA)] =
+        [this](const AppExecFwk::InnerEvent::Pointer& event) { HandleFlushNmea(event); };
 }
 
 GnssHandler::~GnssHandler() {}
@@ -2868,6 +3316,11 @@ void GnssHandler::HandleReportMockLocation(const AppExecFwk::InnerEvent::Pointer
 void GnssHandler::HandleSendLocationRequest(const AppExecFwk::InnerEvent::Pointer& event)
 {
     auto gnssAbility = GnssAbility::GetInstance();
+    // every work record holds all gnss requests, so a burst only needs the latest queued one
+    if (gnssAbility->IsLocationRequestSuperseded(event->GetParam())) {
+        LBSLOGD(GNSS, "work record superseded by a newer one");
+        return;
+    }
     std::unique_ptr<WorkRecord> workrecord = event->GetUniqueObject<WorkRecord>();
     if (workrecord != nullptr) {
         gnssAbility->LocationRequest(*workrecord);
@@ -2954,6 +3407,11 @@ void GnssHandler::HandleRestoreGeofenceRequest(const AppExecFwk::InnerEvent::Poi
     GnssAbility::GetInstance()->RestoreGeofenceRequest();
 }
 
+void GnssHandler::HandleFlushNmea(const AppExecFwk::InnerEvent::Pointer& event)
+{
+    GnssAbility::GetInstance()->FlushPendingNmea(false);
+}
+
 void GnssHandler::HandleAddFence(const AppExecFwk::InnerEvent::Pointer& event)
 {
     auto gnssAbility = GnssAbility::GetInstance();
@@ -190,7 +190,8 @@ int GnssAbilityStub::RegisterGnssStatusCallbackInner(MessageParcel &data, Messag
     AppIdentity appIdentity;
     appIdentity.ReadFromParcel(data);
     sptr<IRemoteObject> client = data.ReadObject<IRemoteObject>();
-    reply.WriteInt32(RegisterGnssStatusCallback(client, appIdentity));
+    int32_t minIntervalMs = data.ReadInt32();
+    reply.WriteInt32(RegisterGnssStatusCallback(client, appIdentity, minIntervalMs));
     return ERRCODE_SUCCESS;
 }
 
@@ -214,7 +215,8 @@ int GnssAbilityStub::RegisterNmeaMessageCallbackInner(
     AppIdentity appIdentity;
     appIdentity.ReadFromParcel(data);
     sptr<IRemoteObject> client = data.ReadObject<IRemoteObject>();
-    reply.WriteInt32(RegisterNmeaMessageCallback(client, appIdentity));
+    int32_t minIntervalMs = data.ReadInt32();
+    reply.WriteInt32(RegisterNmeaMessageCallback(client, appIdentity, minIntervalMs));
     return ERRCODE_SUCCESS;
 }
 
@@ -16,10 +16,10 @@
 #ifdef FEATURE_GNSS_SUPPORT
 #include "gnss_event_callback.h"
 #include <singleton.h>
-#include <sys/time.h>
 #include "ipc_skeleton.h"
 #include "common_utils.h"
 #include "gnss_ability.h"
+#include "gnss_inner_event_aggregator.h"
 #include "location_log.h"
 #include "location_log_event_ids.h"
 #include "common_hisysevent.h"
@@ -41,7 +41,8 @@ const int ELEVATION_DEGREES = 90;
 const int SATELLITES_ADDITIONAL = 4;
 bool g_hasLocation = false;
 bool g_svIncrease = false;
-std::unique_ptr<SatelliteStatus> g_svInfo = nullptr;
+// latest reported status, shared with SendDummySvInfo and replaced as a whole on every update
+std::shared_ptr<SatelliteStatus> g_svInfo = nullptr;
 
 static void SetGpsTime(int64_t gpsTime)
 {
@@ -81,15 +82,7 @@ int32_t GnssEventCallback::ReportLocation(const LocationInfo& location)
     }
     // add dummy sv if needed
     SendDummySvInfo();
-    struct timeval now;
-    gettimeofday(&now, NULL);
-    WriteLocationInnerEvent(RECEIVE_GNSS_LOCATION, {
-        "speed", std::to_string(location.speed),
-        "accuracy", std::to_string(location.horizontalAccuracy),
-        "locationTimestamp", std::to_string(location.timeForFix / MILLI_PER_SEC),
-        "receiveTimestamp", std::to_string(CommonUtils::GetCurrentTimeStamp()),
-        "latitude", std::to_string(location.latitude),
-        "longitude", std::to_string(location.longitude)});
+    GnssInnerEventAggregator::GetInstance()->OnLocation(location, CommonUtils::GetCurrentTimeMilSec());
     gnssAbility->ReportLocationInfo(GNSS_ABILITY, locationNew);
     SetGpsTime(locationNew->GetTimeStamp());
     IPCSkeleton::SetCallingIdentity(identity);
@@ -124,36 +117,30 @@ int32_t GnssEventCallback::ReportSatelliteStatusInfo(const SatelliteStatusInfo&
         LBSLOGD(GNSS, "SvStatusCallback, satellites_num < 0!");
         return ERR_INVALID_VALUE;
     }
-    std::vector<std::string> names;
-    std::vector<std::string> satelliteStatusInfos;
-    names.push_back("SatelliteStatusInfo");
-    satelliteStatusInfos.push_back(std::to_string(info.satellitesNumber));
-
     svStatus->SetSatellitesNumber(info.satellitesNumber);
+    svStatus->ReserveSatellites(info.satellitesNumber);
     for (unsigned int i = 0; i < info.satellitesNumber; i++) {
-        svStatus->SetAltitude(info.elevation[i]);
-        svStatus->SetAzimuth(info.azimuths[i]);
-        svStatus->SetCarrierFrequencie(info.carrierFrequencies[i]);
-        svStatus->SetCarrierToNoiseDensity(info.carrierToNoiseDensitys[i]);
-        svStatus->SetSatelliteId(info.satelliteIds[i]);
-        svStatus->SetConstellationType(info.constellation[i]);
-        svStatus->SetSatelliteAdditionalInfo(info.additionalInfo[i]);
-        std::string str_info = "satelliteId : " + std::to_string(info.satelliteIds[i]) +
-            ", carrierToNoiseDensity : " + std::to_string(info.carrierToNoiseDensitys[i]) +
-            ", elevation : " + std::to_string(info.elevation[i]) +
-            ", azimuth : " + std::to_string(info.azimuths[i]) +
-            ", carrierFrequencie : " + std::to_string(info.carrierFrequencies[i]);
-        names.push_back(std::to_string(i));
-        satelliteStatusInfos.push_back(str_info);
+        SatelliteInfo satellite;
+        satellite.altitude = info.elevation[i];
+        satellite.azimuth = info.azimuths[i];
+        satellite.carrierFrequency = info.carrierFrequencies[i];
+        satellite.carrierToNoiseDensity = info.carrierToNoiseDensitys[i];
+        satellite.satelliteId = info.satelliteIds[i];
+        satellite.constellationType = info.constellation[i];
+        satellite.additionalInfo = info.additionalInfo[i];
+        svStatus->AddSatellite(satellite);
     }
-    // save sv info
-    std::unique_lock<std::mutex> lock(svInfoMutex_, std::defer_lock);
-    lock.lock();
-    g_svInfo = nullptr;
-    g_svInfo = std::make_unique<SatelliteStatus>(*svStatus);
-    lock.unlock();
-    WriteLocationInnerEvent(RECEIVE_SATELLITESTATUSINFO, names, satelliteStatusInfos);
+    GnssInnerEventAggregator::GetInstance()->OnSatelliteStatus(info, CommonUtils::GetCurrentTimeMilSec());
     gnssAbility->ReportSv(svStatus);
+    // save sv info, the reported status is not modified any more so it is kept instead of deep copied
+    std::shared_ptr<SatelliteStatus> svSnapshot = std::move(svStatus);
+    {
+        std::unique_lock<std::mutex> lock(svInfoMutex_);
+        g_svInfo = svSnapshot;
+    }
+    if (!HookUtils::HasHook(LocationProcessStage::GNSS_STATUS_REPORT_PROCESS)) {
+        return ERR_OK;
+    }
     GnssStatusInfo statusInfo;
     statusInfo.cn0 = info.carrierToNoiseDensitys;
     statusInfo.availableTimeStamp = CommonUtils::GetCurrentTimeStamp() * MILLI_PER_SEC;
@@ -164,18 +151,22 @@ int32_t GnssEventCallback::ReportSatelliteStatusInfo(const SatelliteStatusInfo&
 
 void GnssEventCallback::SendDummySvInfo()
 {
-    std::unique_lock<std::mutex> lock(svInfoMutex_);
-    if (g_svInfo == nullptr) {
+    std::shared_ptr<SatelliteStatus> svInfo;
+    {
+        std::unique_lock<std::mutex> lock(svInfoMutex_);
+        svInfo = g_svInfo;
+    }
+    if (svInfo == nullptr) {
         LBSLOGE(GNSS, "%{public}s: sv is nullptr.", __func__);
         return;
     }
     // indicates location is coming
     g_hasLocation = true;
     int usedSvCount = 0;
-    int svListSize = g_svInfo->GetSatellitesNumber();
+    int svListSize = svInfo->GetSatellitesNumber();
     // calculate the num of used GPS satellites
     for (int svSize = 0; svSize < svListSize; svSize++) {
-        if (IsSvTypeGps(g_svInfo, svSize) && IsSvUsed(g_svInfo, svSize)) {
+        if (IsSvTypeGps(svInfo, svSize) && IsSvUsed(svInfo, svSize)) {
             usedSvCount++;
         }
     }
@@ -187,14 +178,21 @@ void GnssEventCallback::SendDummySvInfo()
         LBSLOGD(GNSS, "%{public}s: start increase dummy sv", __func__);
 
         if (MAX_SV_COUNT - svListSize >= GPS_DUMMY_SV_COUNT) {
-            AddDummySv(g_svInfo, 4, 6); // sv1: svid = 4, cN0Dbhz = 6
-            AddDummySv(g_svInfo, 7, 15); // sv2: svid = 7, cN0Dbhz = 15
-            AddDummySv(g_svInfo, 1, 2); // sv3: svid = 1, cN0Dbhz = 2
-            AddDummySv(g_svInfo, 11, 10); // sv4: svid = 11, cN0Dbhz = 10
-            AddDummySv(g_svInfo, 17, 5); // sv5: svid = 17, cN0Dbhz = 5
-            g_svInfo->
-                SetSatellitesNumber(g_svInfo->GetSatellitesNumber() + GPS_DUMMY_SV_COUNT);
-            ReportDummySv(g_svInfo);
+            // the snapshot may be read by others, dummy satellites are added to a copy of it
+            std::unique_ptr<SatelliteStatus> dummySvInfo = std::make_unique<SatelliteStatus>(*svInfo);
+            AddDummySv(dummySvInfo, 4, 6); // sv1: svid = 4, cN0Dbhz = 6
+            AddDummySv(dummySvInfo, 7, 15); // sv2: svid = 7, cN0Dbhz = 15
+            AddDummySv(dummySvInfo, 1, 2); // sv3: svid = 1, cN0Dbhz = 2
+            AddDummySv(dummySvInfo, 11, 10); // sv4: svid = 11, cN0Dbhz = 10
+            AddDummySv(dummySvInfo, 17, 5); // sv5: svid = 17, cN0Dbhz = 5
+            dummySvInfo->
+                SetSatellitesNumber(dummySvInfo->GetSatellitesNumber() + GPS_DUMMY_SV_COUNT);
+            ReportDummySv(dummySvInfo);
+            std::unique_lock<std::mutex> lock(svInfoMutex_);
+            // a newer status reported meanwhile wins over the one with dummy satellites
+            if (g_svInfo == svInfo) {
+                g_svInfo = std::move(dummySvInfo);
+            }
         } else {
             LBSLOGD(GNSS, "%{public}s: sv number > 58, no need send dummy satellites", __func__);
         }
@@ -223,20 +221,20 @@ bool GnssEventCallback::IsNeedSvIncrease()
     return false;
 }
 
-bool GnssEventCallback::IsSvTypeGps(const std::unique_ptr<SatelliteStatus> &sv, int index)
+bool GnssEventCallback::IsSvTypeGps(const std::shared_ptr<SatelliteStatus> &sv, int index)
 {
     if (sv == nullptr) {
         return false;
     }
-    return sv->GetConstellationTypes()[index] == HDI::Location::Gnss::V2_0::CONSTELLATION_CATEGORY_GPS;
+    return sv->GetConstellationType(index) == HDI::Location::Gnss::V2_0::CONSTELLATION_CATEGORY_GPS;
 }
 
-bool GnssEventCallback::IsSvUsed(const std::unique_ptr<SatelliteStatus> &sv, int index)
+bool GnssEventCallback::IsSvUsed(const std::shared_ptr<SatelliteStatus> &sv, int index)
 {
     if (sv == nullptr) {
         return false;
     }
-    return static_cast<uint32_t>(sv->GetSatelliteAdditionalInfoList()[index]) &
+    return static_cast<uint32_t>(sv->GetSatelliteAdditionalInfo(index)) &
         static_cast<uint8_t>(HDI::Location::Gnss::V2_0::SATELLITES_ADDITIONAL_INFO_USED_IN_FIX);
 }
 
@@ -245,13 +243,15 @@ void GnssEventCallback::AddDummySv(std::unique_ptr<SatelliteStatus> &sv, int svi
     if (sv == nullptr) {
         return;
     }
-    sv->SetSatelliteId(svid);
-    sv->SetConstellationType(HDI::Location::Gnss::V2_0::CONSTELLATION_CATEGORY_GPS);
-    sv->SetCarrierToNoiseDensity(cN0Dbhz);
-    sv->SetAltitude(ELEVATION_DEGREES); // elevationDegrees
-    sv->SetAzimuth(AZIMUTH_DEGREES); // azimuthDegrees
-    sv->SetCarrierFrequencie(0); // carrierFrequencyHz
-    sv->SetSatelliteAdditionalInfo(SATELLITES_ADDITIONAL); // satellites_additional
+    SatelliteInfo satellite;
+    satellite.satelliteId = svid;
+    satellite.constellationType = HDI::Location::Gnss::V2_0::CONSTELLATION_CATEGORY_GPS;
+    satellite.carrierToNoiseDensity = cN0Dbhz;
+    satellite.altitude = ELEVATION_DEGREES; // elevationDegrees
+    satellite.azimuth = AZIMUTH_DEGREES; // azimuthDegrees
+    satellite.carrierFrequency = 0; // carrierFrequencyHz
+    satellite.additionalInfo = SATELLITES_ADDITIONAL; // satellites_additional
+    sv->AddSatellite(satellite);
 }
 
 int32_t GnssEventCallback::RequestGnssReferenceInfo(GnssRefInfoType type)
@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef FEATURE_GNSS_SUPPORT
+#include "gnss_inner_event_aggregator.h"
+
+#include <algorithm>
+
+#include "common_hisysevent.h"
+#include "common_utils.h"
+#include "location_log.h"
+#include "location_log_event_ids.h"
+#include "parameters.h"
+
+namespace OHOS {
+namespace Location {
+namespace {
+const int64_t DEFAULT_INNER_EVENT_WINDOW_MS = 60 * 1000;
+// one raw event per minute of a 1Hz stream
+const int DEFAULT_RAW_INNER_EVENT_SAMPLE_RATE = 60;
+static const std::string SYSPARAM_INNER_EVENT_WINDOW_MS = "persist.location.gnss_inner_event_window_ms";
+static const std::string SYSPARAM_RAW_INNER_EVENT_SAMPLE_RATE = "persist.location.gnss_raw_inner_event_sample_rate";
+}
+
+GnssInnerEventAggregator* GnssInnerEventAggregator::GetInstance()
+{
+    static GnssInnerEventAggregator data;
+    return &data;
+}
+
+GnssInnerEventAggregator::GnssInnerEventAggregator()
+    : GnssInnerEventAggregator(
+        OHOS::system::GetIntParameter(SYSPARAM_INNER_EVENT_WINDOW_MS, DEFAULT_INNER_EVENT_WINDOW_MS),
+        OHOS::system::GetIntParameter(SYSPARAM_RAW_INNER_EVENT_SAMPLE_RATE, DEFAULT_RAW_INNER_EVENT_SAMPLE_RATE))
+{
+}
+
+GnssInnerEventAggregator::GnssInnerEventAggregator(int64_t windowMs, int rawEventSampleRate)
+    : windowMs_(windowMs > 0 ? windowMs : DEFAULT_INNER_EVENT_WINDOW_MS),
+    rawEventSampleRate_(std::max(rawEventSampleRate, 0))
+{
+}
+
+void GnssInnerEventAggregator::OnLocation(const LocationInfo& location, int64_t receiveTime)
+{
+    GnssLocationWindowStats locationStats;
+    GnssSatelliteWindowStats satelliteStats;
+    bool isWindowElapsed = false;
+    bool isRawSampled = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        isWindowElapsed = TakeElapsedWindow(receiveTime, locationStats, satelliteStats);
+        isRawSampled = IsRawEventSampled(locationReportCount_);
+        double accuracy = location.horizontalAccuracy;
+        if (locationStats_.count == 0) {
+            locationStats_.minAccuracy = accuracy;
+            locationStats_.maxAccuracy = accuracy;
+        } else {
+            locationStats_.minAccuracy = std::min(locationStats_.minAccuracy, accuracy);
+            locationStats_.maxAccuracy = std::max(locationStats_.maxAccuracy, accuracy);
+        }
+        locationStats_.sumAccuracy += accuracy;
+        locationStats_.count++;
+        int64_t interval = location.timeForFix - locationStats_.lastFixTime;
+        if (locationStats_.lastFixTime > 0 && interval > 0) {
+            if (locationStats_.intervalCount == 0) {
+                locationStats_.minInterval = interval;
+                locationStats_.maxInterval = interval;
+            } else {
+                locationStats_.minInterval = std::min(locationStats_.minInterval, interval);
+                locationStats_.maxInterval = std::max(locationStats_.maxInterval, interval);
+            }
+            locationStats_.sumInterval += interval;
+            locationStats_.intervalCount++;
+        }
+        locationStats_.lastFixTime = location.timeForFix;
+    }
+    if (isWindowElapsed) {
+        WriteSummaryEvents(locationStats, satelliteStats);
+    }
+    if (isRawSampled) {
+        WriteRawLocationEvent(location, receiveTime);
+    }
+}
+
+void GnssInnerEventAggregator::OnSatelliteStatus(const SatelliteStatusInfo& info, int64_t receiveTime)
+{
+    if (info.satellitesNumber < 0) {
+        return;
+    }
+    GnssLocationWindowStats locationStats;
+    GnssSatelliteWindowStats satelliteStats;
+    bool isWindowElapsed = false;
+    bool isRawSampled = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        isWindowElapsed = TakeElapsedWindow(receiveTime, locationStats, satelliteStats);
+        isRawSampled = IsRawEventSampled(satelliteReportCount_);
+        int satellitesNumber = static_cast<int>(info.satellitesNumber);
+        int usedSatellites = 0;
+        for (size_t i = 0; i < info.additionalInfo.size() && i < static_cast<size_t>(satellitesNumber); i++) {
+            if (static_cast<uint32_t>(info.additionalInfo[i]) &
+                static_cast<uint32_t>(HDI::Location::Gnss::V2_0::SATELLITES_ADDITIONAL_INFO_USED_IN_FIX)) {
+                usedSatellites++;
+            }
+        }
+        if (satelliteStats_.count == 0) {
+            satelliteStats_.minUsedSatellites = usedSatellites;
+            satelliteStats_.maxUsedSatellites = usedSatellites;
+        } else {
+            satelliteStats_.minUsedSatellites = std::min(satelliteStats_.minUsedSatellites, usedSatellites);
+            satelliteStats_.maxUsedSatellites = std::max(satelliteStats_.maxUsedSatellites, usedSatellites);
+        }
+        satelliteStats_.maxSatellites = std::max(satelliteStats_.maxSatellites, satellitesNumber);
+        satelliteStats_.sumSatellites += satellitesNumber;
+        satelliteStats_.sumUsedSatellites += usedSatellites;
+        satelliteStats_.count++;
+    }
+    if (isWindowElapsed) {
+        WriteSummaryEvents(locationStats, satelliteStats);
+    }
+    if (isRawSampled) {
+        WriteRawSatelliteStatusEvent(info);
+    }
+}
+
+void GnssInnerEventAggregator::Flush()
+{
+    GnssLocationWindowStats locationStats;
+    GnssSatelliteWindowStats satelliteStats;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        locationStats = locationStats_;
+        satelliteStats = satelliteStats_;
+        // the next session starts a fresh window, fix intervals do not span sessions
+        locationStats_ = GnssLocationWindowStats();
+        satelliteStats_ = GnssSatelliteWindowStats();
+        windowStartTime_ = 0;
+    }
+    WriteSummaryEvents(locationStats, satelliteStats);
+}
+
+bool GnssInnerEventAggregator::IsRawEventSampled(int64_t& reportCount)
+{
+    if (rawEventSampleRate_ == 0) {
+        return false;
+    }
+    return (reportCount++ % rawEventSampleRate_) == 0;
+}
+
+bool GnssInnerEventAggregator::TakeElapsedWindow(int64_t receiveTime, GnssLocationWindowStats& locationStats,
+    GnssSatelliteWindowStats& satelliteStats)
+{
+    if (windowStartTime_ == 0) {
+        windowStartTime_ = receiveTime;
+        return false;
+    }
+    if (receiveTime - windowStartTime_ < windowMs_) {
+        return false;
+    }
+    locationStats = locationStats_;
+    satelliteStats = satelliteStats_;
+    int64_t lastFixTime = locationStats_.lastFixTime;
+    locationStats_ = GnssLocationWindowStats();
+    locationStats_.lastFixTime = lastFixTime;
+    satelliteStats_ = GnssSatelliteWindowStats();
+    windowStartTime_ = receiveTime;
+    return true;
+}
+
+void GnssInnerEventAggregator::WriteSummaryEvents(const GnssLocationWindowStats& locationStats,
+    const GnssSatelliteWindowStats& satelliteStats)
+{
+    if (locationStats.count > 0) {
+        std::vector<std::string> names = {"count", "minAccuracy", "maxAccuracy", "meanAccuracy",
+            "minFixInterval", "maxFixInterval", "meanFixInterval", "fixIntervalJitter"};
+        int64_t meanInterval = locationStats.intervalCount > 0 ?
+            locationStats.sumInterval / locationStats.intervalCount : 0;
+        std::vector<std::string> values = {std::to_string(locationStats.count),
+            std::to_string(locationStats.minAccuracy), std::to_string(locationStats.maxAccuracy),
+            std::to_string(locationStats.sumAccuracy / locationStats.count),
+            std::to_string(locationStats.minInterval), std::to_string(locationStats.maxInterval),
+            std::to_string(meanInterval), std::to_string(locationStats.maxInterval - locationStats.minInterval)};
+        WriteInnerEvent(RECEIVE_GNSS_LOCATION_SUMMARY, names, values);
+    }
+    if (satelliteStats.count > 0) {
+        std::vector<std::string> names = {"count", "meanSatellites", "maxSatellites",
+            "meanUsedSatellites", "minUsedSatellites", "maxUsedSatellites"};
+        std::vector<std::string> values = {std::to_string(satelliteStats.count),
+            std::to_string(satelliteStats.sumSatellites / satelliteStats.count),
+            std::to_string(satelliteStats.maxSatellites),
+            std::to_string(satelliteStats.sumUsedSatellites / satelliteStats.count),
+            std::to_string(satelliteStats.minUsedSatellites), std::to_string(satelliteStats.maxUsedSatellites)};
+        WriteInnerEvent(RECEIVE_SATELLITESTATUSINFO_SUMMARY, names, values);
+    }
+}
+
+void GnssInnerEventAggregator::WriteRawLocationEvent(const LocationInfo& location, int64_t receiveTime)
+{
+    std::vector<std::string> names = {"speed", "accuracy", "locationTimestamp", "receiveTimestamp",
+        "latitude", "longitude"};
+    std::vector<std::string> values = {std::to_string(location.speed),
+        std::to_string(location.horizontalAccuracy), std::to_string(location.timeForFix / MILLI_PER_SEC),
+        std::to_string(receiveTime / MILLI_PER_SEC), std::to_string(location.latitude),
+        std::to_string(location.longitude)};
+    WriteInnerEvent(RECEIVE_GNSS_LOCATION, names, values);
+}
+
+void GnssInnerEventAggregator::WriteRawSatelliteStatusEvent(const SatelliteStatusInfo& info)
+{
+    std::vector<std::string> names;
+    std::vector<std::string> satelliteStatusInfos;
+    names.push_back("SatelliteStatusInfo");
+    satelliteStatusInfos.push_back(std::to_string(info.satellitesNumber));
+    for (unsigned int i = 0; i < info.satellitesNumber; i++) {
+        std::string str_info = "satelliteId : " + std::to_string(info.satelliteIds[i]) +
+            ", carrierToNoiseDensity : " + std::to_string(info.carrierToNoiseDensitys[i]) +
+            ", elevation : " + std::to_string(info.elevation[i]) +
+            ", azimuth : " + std::to_string(info.azimuths[i]) +
+            ", carrierFrequencie : " + std::to_string(info.carrierFrequencies[i]);
+        names.push_back(std::to_string(i));
+        satelliteStatusInfos.push_back(str_info);
+    }
+    WriteInnerEvent(RECEIVE_SATELLITESTATUSINFO, names, satelliteStatusInfos);
+}
+
+void GnssInnerEventAggregator::WriteInnerEvent(int event, std::vector<std::string>& names,
+    std::vector<std::string>& values)
+{
+    WriteLocationInnerEvent(event, names, values);
+}
+}  // namespace Location
+}  // namespace OHOS
+#endif // FEATURE_GNSS_SUPPORT
@@ -36,6 +36,7 @@ public:
     static AppBackgroundStatusManager* GetInstance();
     bool IsAppBackground(std::string bundleName);
     bool IsAppBackground(int uid, std::string bundleName);
+    bool IsAppForeground(int uid);
     bool IsAppInLocationContinuousTasks(pid_t uid, pid_t pid);
     bool IsAppHasFormVisible(uint32_t tokenId, uint64_t tokenIdEx);
     void UpdateBackgroundAppStatues(int32_t uid, int32_t status);
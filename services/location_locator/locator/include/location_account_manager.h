@@ -40,6 +40,7 @@ public:
 private:
     std::vector<int> activeIds_;
     void SubscribeSaStatusChangeListerner();
+    static void AddAccountEvents(OHOS::EventFwk::MatchingSkills& matchingSkills);
 
     class UserSwitchSubscriber : public OHOS::EventFwk::CommonEventSubscriber {
     public:
@@ -140,6 +140,27 @@ public:
      * @return int - nlp enable state
      */
     int GetNlpEnableState();
+
+    /*
+     * @Description get the lower bound of the idle time before the nlp service is disconnected
+     *
+     * @return int - min disconnect delay in milliseconds
+     */
+    int GetNlpDisconnectMinMs();
+
+    /*
+     * @Description get the upper bound of the idle time before the nlp service is disconnected
+     *
+     * @return int - max disconnect delay in milliseconds
+     */
+    int GetNlpDisconnectMaxMs();
+
+    /*
+     * @Description get the max number of positions kept in the reverse geocoding cache
+     *
+     * @return int - cache capacity
+     */
+    int GetGeocodeCacheCapacity();
 private:
     LocationConfigManager();
     std::string GetLocationSwitchConfigPath();
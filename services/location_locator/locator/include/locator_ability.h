@@ -109,6 +109,7 @@ private:
     void InitSaAbilityEvent(const AppExecFwk::InnerEvent::Pointer& event);
     void InitMonitorManagerEvent(const AppExecFwk::InnerEvent::Pointer& event);
     void IsStandByEvent(const AppExecFwk::InnerEvent::Pointer& event);
+    void RequestDeadlineEvent(const AppExecFwk::InnerEvent::Pointer& event);
     void SetLocationWorkingStateEvent(const AppExecFwk::InnerEvent::Pointer& event);
     void SetSwitchStateToDbEvent(const AppExecFwk::InnerEvent::Pointer& event);
     void SetSwitchStateToDbForUserEvent(const AppExecFwk::InnerEvent::Pointer& event);
@@ -152,8 +153,10 @@ public:
     ErrCode EnableAbility(bool isEnabled) override;
     ErrCode EnableAbilityForUser(bool isEnabled, int32_t userId) override;
     ErrCode RegisterGnssStatusCallback(const sptr<IRemoteObject>& cb) override;
+    ErrCode RegisterGnssStatusCallbackWithInterval(const sptr<IRemoteObject>& cb, int32_t minIntervalMs) override;
     ErrCode UnregisterGnssStatusCallback(const sptr<IRemoteObject>& cb) override;
     ErrCode RegisterNmeaMessageCallback(const sptr<IRemoteObject>& cb) override;
+    ErrCode RegisterNmeaMessageCallbackWithInterval(const sptr<IRemoteObject>& cb, int32_t minIntervalMs) override;
     ErrCode UnregisterNmeaMessageCallback(const sptr<IRemoteObject>& cb) override;
     ErrCode RegisterCachedLocationCallback(int32_t reportingPeriodSec, bool wakeUpCacheQueueFull,
         const sptr<ICachedLocationsCallback>& cb, const std::string& bundleName) override;
@@ -182,6 +185,7 @@ public:
     ErrCode DisableLocationMock() override;
     ErrCode SetMockedLocations(int32_t timeInterval, const std::vector<Location>& locations) override;
     ErrCode ReportLocation(const std::string& abilityName, const Location& location) override;
+    ErrCode ReportLocalLocation(const std::string& abilityName, const std::unique_ptr<Location>& location);
     ErrCode ReportLocationStatus(const sptr<ILocatorCallback>& callback, int result);
     ErrCode ReportErrorStatus(const sptr<ILocatorCallback>& callback, int result);
     LocationErrCode ProcessLocationMockMsg(
@@ -215,7 +219,9 @@ public:
     std::shared_ptr<std::map<sptr<IRemoteObject>, std::list<std::shared_ptr<Request>>>> GetReceivers();
     std::shared_ptr<std::map<std::string, sptr<IRemoteObject>>> GetProxyMap();
     void UpdateSaAbilityHandler();
-    void ApplyRequests(int delay);
+    // isGlobalChange drops the cached verdicts of all requests before they are applied
+    void ApplyRequests(int delay, bool isGlobalChange);
+    void ScheduleRequestDeadline(int64_t delayMs);
     void RegisterAction();
     void RegisterLocationPrivacyAction();
     ErrCode ProxyForFreeze(const std::vector<int32_t>& pidList, bool isProxy) override;
@@ -261,6 +267,7 @@ public:
 
 private:
     bool Init();
+    void RegisterLocalLocationReporter();
     bool CheckSaValid();
 #ifdef FEATURE_GNSS_SUPPORT
     LocationErrCode SendGnssRequest(int type, MessageParcel &data, MessageParcel &reply);
@@ -48,22 +48,34 @@ public:
     bool IsAppBackground(std::string bundleName, uint32_t tokenId, uint64_t tokenIdEx, pid_t uid, pid_t pid);
     static ReportManager* GetInstance();
     bool IsCacheGnssLocationValid();
+    void InvalidateAuthSnapshot();
 
 private:
     struct timespec lastUpdateTime_;
     double offsetRandom_;
-    std::map<int, std::shared_ptr<Location>> lastLocationsMap_;
-    Location cacheGnssLocation_;
-    Location cacheNlpLocation_;
+    // copy-on-write, every active user shares one immutable location of the latest fix
+    std::shared_ptr<const std::map<int, std::shared_ptr<const Location>>> lastLocationsMap_;
+    // immutable snapshots, readers take the pointer atomically and never copy the location
+    std::shared_ptr<const Location> cacheGnssLocation_;
+    std::shared_ptr<const Location> cacheNlpLocation_;
+    bool isCacheNlpFromIndoor_ = false;
     std::mutex lastLocationMutex_;
-    std::mutex cacheGnssLocationMutex_;
     std::mutex cacheNlpLocationMutex_;
     std::atomic<int64_t> lastResetRecordTime_;
+    std::atomic<uint64_t> authSnapshotGeneration_;
+    std::atomic<uint64_t> authSnapshotHitCount_;
     std::unique_ptr<Location> ApproximatelyLocation(const std::unique_ptr<Location>& location,
         const std::shared_ptr<Request>& request);
     bool ProcessRequestForReport(std::shared_ptr<Request>& request,
         std::unique_ptr<std::list<std::shared_ptr<Request>>>& deadRequests,
         const std::unique_ptr<Location>& location, std::string abilityName);
+    std::unique_ptr<Location> GetAuthorizedLocation(std::shared_ptr<Request>& request,
+        const std::unique_ptr<Location>& location);
+    std::unique_ptr<Location> GetLocationByPermissionLevel(const std::shared_ptr<Request>& request,
+        const std::unique_ptr<Location>& location, int permissionLevel);
+    bool ResultCheckByPermissionLevel(const std::unique_ptr<Location>& location,
+        const std::shared_ptr<Request>& request, int permissionLevel);
+    bool IsAuthSnapshotCacheable(const std::shared_ptr<Request>& request);
     bool ReportLocationByCallback(std::shared_ptr<Request>& request,
         const std::unique_ptr<Location>& finalLocation);
     void WriteNetWorkReportEvent(std::string abilityName, const std::shared_ptr<Request>& request,
@@ -76,10 +88,11 @@ private:
     void LocationReportDelayTimeCheck(const std::unique_ptr<Location>& location,
         const std::shared_ptr<Request>& request);
     bool NeedUpdateTimeStamp(std::unique_ptr<Location>& fuseLocation, const std::shared_ptr<Request>& request);
-    void UpdateCacheGnssLocation(Location& location);
-    void UpdateCacheNlpLocation(Location& location);
-    Location& GetCacheGnssLocation();
-    std::shared_ptr<Location> GetCacheNlpLocation();
+    void UpdateCacheGnssLocation(const Location& location);
+    void UpdateCacheNlpLocation(const Location& location);
+    std::shared_ptr<const Location> GetCacheGnssLocation();
+    std::shared_ptr<const Location> GetCacheNlpLocation();
+    bool IsCacheLocationInTime(const std::shared_ptr<const Location>& location, int64_t curTime, int cachedTime);
     bool CheckIfGnssAbnormal(const std::unique_ptr<Location>& location);
 };
 } // namespace OHOS
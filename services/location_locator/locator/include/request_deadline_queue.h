@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REQUEST_DEADLINE_QUEUE_H
+#define REQUEST_DEADLINE_QUEUE_H
+
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ffrt.h"
+
+#include "request.h"
+
+namespace OHOS {
+namespace Location {
+constexpr int64_t INVALID_REQUEST_DEADLINE = -1;
+
+/**
+ * Ordered deadlines of single-shot requests, all operations are O(log n).
+ */
+class RequestDeadlineQueue {
+public:
+    RequestDeadlineQueue();
+    ~RequestDeadlineQueue();
+    /**
+     * add or move the deadline of the request, return true if the earliest deadline changed.
+     */
+    bool Push(const std::shared_ptr<Request>& request, int64_t deadline);
+    bool Remove(const std::shared_ptr<Request>& request);
+    std::vector<std::shared_ptr<Request>> PopExpired(int64_t now);
+    int64_t GetNextDeadline();
+    size_t Size();
+private:
+    void RemoveLocked(const std::shared_ptr<Request>& request);
+
+    std::set<std::pair<int64_t, std::shared_ptr<Request>>> deadlines_;
+    std::unordered_map<std::shared_ptr<Request>, int64_t> deadlineIndex_;
+    ffrt::mutex deadlineMutex_;
+};
+} // namespace Location
+} // namespace OHOS
+#endif // REQUEST_DEADLINE_QUEUE_H
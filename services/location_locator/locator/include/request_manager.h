@@ -27,6 +27,7 @@
 
 #include "i_locator_callback.h"
 #include "request.h"
+#include "request_deadline_queue.h"
 #include "work_record.h"
 
 namespace OHOS {
@@ -62,6 +63,9 @@ public:
     void HandlePowerSuspendChanged(int32_t pid, int32_t uid, int32_t flag);
     void UpdateRequestRecord(std::shared_ptr<Request> request, bool shouldInsert);
     void HandleRequest();
+    void InvalidateWorkRecord();
+    void InvalidateWorkRecord(const std::shared_ptr<Request>& request);
+    void InvalidateWorkRecordByUid(int32_t uid);
     bool UpdateUsingPermission(std::shared_ptr<Request> request, const bool isStart);
     void IncreaseWorkingPidsCount(const pid_t pid);
     void DecreaseWorkingPidsCount(const pid_t pid);
@@ -77,6 +81,7 @@ public:
     void UpdateLocationError(std::shared_ptr<Request> request);
     bool IsGnssDelayEligible(std::shared_ptr<Request>& request, size_t requestCount);
     void HandleGnssRequestHaEvent();
+    void HandleRequestDeadline();
     
 private:
     bool RestorRequest(std::shared_ptr<Request> request);
@@ -92,6 +97,11 @@ private:
     bool AddRequestToWorkRecord(std::string abilityName, std::shared_ptr<Request>& request,
         std::shared_ptr<WorkRecord>& workRecord);
     bool IsRequestAvailable(std::shared_ptr<Request>& request);
+    bool IsRequestTimeout(const std::shared_ptr<Request>& request);
+    void AddRequestDeadline(const std::shared_ptr<Request>& request);
+    void ScheduleRequestDeadline();
+    bool IsEvaluationReusable(const std::shared_ptr<Request>& request,
+        const std::map<std::shared_ptr<Request>, std::pair<uint64_t, bool>>& evaluationMap, uint64_t generation);
     void UpdateRunningUids(const std::shared_ptr<Request>& request, std::string abilityName, bool isAdd);
     void ReportDataToResSched(std::string state, const pid_t pid, const pid_t uid);
     std::map<int32_t, int32_t> runningUidMap_;
@@ -104,6 +114,12 @@ private:
     std::atomic_bool isDeviceStillState_;
     ffrt::mutex workingPidsCountMutex_;
     std::map<pid_t, int32_t> workingPidsCountMap_;
+    // per ability, the generation and the result of the last AddRequestToWorkRecord of each request
+    std::map<std::string, std::map<std::shared_ptr<Request>, std::pair<uint64_t, bool>>> workRecordEvaluationMap_;
+    ffrt::mutex workRecordEvaluationMutex_;
+    std::atomic<uint64_t> workRecordGeneration_;
+    // single-shot requests ordered by the time they time out, in monotonic ms
+    RequestDeadlineQueue requestDeadlineQueue_;
 };
 
 class LocatorErrCallbackDeathRecipient : public IRemoteObject::DeathRecipient {
@@ -16,6 +16,7 @@
 #ifndef SUBABILITY_COMMON_H
 #define SUBABILITY_COMMON_H
 
+#include <string>
 #include <vector>
 
 #include "iremote_broker.h"
@@ -47,6 +48,7 @@ public:
     void Enable(bool state, const sptr<IRemoteObject> ability);
     void HandleRefrashRequirements();
     int GetRequestNum();
+    int GetMinTimeInterval();
     bool EnableLocationMock();
     bool DisableLocationMock();
     bool SetMockedLocations(const int timeInterval, const std::vector<std::shared_ptr<Location>> &location);
@@ -63,6 +65,7 @@ private:
     void HandleLocalRequest(WorkRecord &record);
     void HandleRemoveRecord(WorkRecord &newRecord);
     void HandleAddRecord(WorkRecord &newRecord);
+    std::string GetRecordKey(WorkRecord &record, int index);
     void CacheLocationMock(const std::vector<std::shared_ptr<Location>> &location);
     virtual void RequestRecord(WorkRecord &workRecord, bool isAdded) = 0;
     virtual void SendReportMockLocationEvent() = 0;
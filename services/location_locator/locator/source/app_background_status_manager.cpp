@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <mutex>
 #include "common_utils.h"
+#include "report_manager.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
 #include "os_account_manager.h"
@@ -88,17 +89,26 @@ bool AppBackgroundStatusManager::IsAppBackground(int uid, std::string bundleName
     return false;
 }
 
-void AppBackgroundStatusManager::UpdateBackgroundAppStatues(int32_t uid, int32_t status)
+bool AppBackgroundStatusManager::IsAppForeground(int uid)
 {
     std::unique_lock lock(foregroundAppMutex_);
-    if (status == FOREGROUPAPP_STATUS) {
-        foregroundAppMap_[uid] = status;
-    } else {
-        auto iter = foregroundAppMap_.find(uid);
-        if (iter != foregroundAppMap_.end()) {
-            foregroundAppMap_.erase(iter);
+    return foregroundAppMap_.find(uid) != foregroundAppMap_.end();
+}
+
+void AppBackgroundStatusManager::UpdateBackgroundAppStatues(int32_t uid, int32_t status)
+{
+    {
+        std::unique_lock lock(foregroundAppMutex_);
+        if (status == FOREGROUPAPP_STATUS) {
+            foregroundAppMap_[uid] = status;
+        } else {
+            auto iter = foregroundAppMap_.find(uid);
+            if (iter != foregroundAppMap_.end()) {
+                foregroundAppMap_.erase(iter);
+            }
         }
     }
+    ReportManager::GetInstance()->InvalidateAuthSnapshot();
     LBSLOGD(REQUEST_MANAGER, "UpdateBackgroundApp uid = %{public}d, state = %{public}d", uid, status);
 }
 
@@ -70,6 +70,13 @@ std::unique_ptr<Location> FusionController::chooseBestLocation(const std::unique
     if (lastFuseLocation == nullptr) {
         return std::make_unique<Location>(*location);
     }
+    if (!HookUtils::HasHook(LocationProcessStage::FUSION_REPORT_PROCESS)) {
+        if (location->GetLocationSourceType() == LocationSourceType::NETWORK_TYPE &&
+            CheckIfLastGnssLocationValid(location, lastFuseLocation)) {
+            return std::make_unique<Location>(*lastFuseLocation);
+        }
+        return std::make_unique<Location>(*location);
+    }
     LocationFusionInfo fusionInfo;
     fusionInfo.location = *location;
     fusionInfo.lastFuseLocation = *lastFuseLocation;
@@ -85,7 +85,8 @@ LocationErrCode GnssAbilityProxy::RefrashRequirements()
     return LocationErrCode(reply.ReadInt32());
 }
 
-LocationErrCode GnssAbilityProxy::RegisterGnssStatusCallback(const sptr<IRemoteObject>& callback, AppIdentity &identity)
+LocationErrCode GnssAbilityProxy::RegisterGnssStatusCallback(const sptr<IRemoteObject>& callback, AppIdentity &identity,
+    int32_t minIntervalMs)
 {
     MessageParcel data;
     MessageParcel reply;
@@ -98,6 +99,7 @@ LocationErrCode GnssAbilityProxy::RegisterGnssStatusCallback(const sptr<IRemoteO
         identity.GetUid(), identity.GetTokenId());
     identity.Marshalling(data);
     data.WriteRemoteObject(callback);
+    data.WriteInt32(minIntervalMs);
     int error =
         Remote()->SendRequest(static_cast<uint32_t>(GnssInterfaceCode::REG_GNSS_STATUS), data, reply, option);
     if (error != ERR_OK) {
@@ -125,7 +127,7 @@ LocationErrCode GnssAbilityProxy::UnregisterGnssStatusCallback(const sptr<IRemot
 }
 
 LocationErrCode GnssAbilityProxy::RegisterNmeaMessageCallback(const sptr<IRemoteObject>& callback,
-    AppIdentity &identity)
+    AppIdentity &identity, int32_t minIntervalMs)
 {
     MessageParcel data;
     MessageParcel reply;
@@ -138,6 +140,7 @@ LocationErrCode GnssAbilityProxy::RegisterNmeaMessageCallback(const sptr<IRemote
         identity.GetUid(), identity.GetTokenId());
     identity.Marshalling(data);
     data.WriteRemoteObject(callback);
+    data.WriteInt32(minIntervalMs);
     int error = Remote()->SendRequest(static_cast<uint32_t>(GnssInterfaceCode::REG_NMEA), data, reply, option);
     LBSLOGI(GNSS, "%{public}s Transact Error = %{public}d", __func__, error);
     return LocationErrCode(reply.ReadInt32());
@@ -17,7 +17,9 @@
 #include <vector>
 #include <algorithm>
 #include <mutex>
+#include "active_account_cache.h"
 #include "common_utils.h"
+#include "report_manager.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
 #include "os_account_manager.h"
@@ -50,6 +52,14 @@ LocationAccountManager::~LocationAccountManager()
 {
 }
 
+void LocationAccountManager::AddAccountEvents(OHOS::EventFwk::MatchingSkills& matchingSkills)
+{
+    matchingSkills.AddEvent(OHOS::EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED);
+    matchingSkills.AddEvent(OHOS::EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED);
+    matchingSkills.AddEvent(OHOS::EventFwk::CommonEventSupport::COMMON_EVENT_USER_STARTED);
+    matchingSkills.AddEvent(OHOS::EventFwk::CommonEventSupport::COMMON_EVENT_USER_STOPPED);
+}
+
 std::vector<int> LocationAccountManager::GetActiveUserIds()
 {
     std::unique_lock<std::mutex> lock(accountMutex_);
@@ -65,6 +75,7 @@ void LocationAccountManager::OnUserSwitch(int32_t userId)
     if (!containsActiveId) {
         activeIds_.push_back(userId);
     }
+    ReportManager::GetInstance()->InvalidateAuthSnapshot();
 }
 
 void LocationAccountManager::OnUserRemove(int32_t userId)
@@ -76,13 +87,14 @@ void LocationAccountManager::OnUserRemove(int32_t userId)
     if (iter != activeIds_.end()) {
         activeIds_.erase(iter);
     }
+    ReportManager::GetInstance()->InvalidateAuthSnapshot();
 }
 
 void LocationAccountManager::SubscribeSaStatusChangeListerner()
 {
     std::unique_lock lock(accountMutex_);
     OHOS::EventFwk::MatchingSkills matchingSkills;
-    matchingSkills.AddEvent(OHOS::EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED);
+    AddAccountEvents(matchingSkills);
     OHOS::EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
     if (subscriber_ == nullptr) {
         subscriber_ = std::make_shared<UserSwitchSubscriber>(subscriberInfo);
@@ -112,6 +124,8 @@ void LocationAccountManager::UserSwitchSubscriber::OnReceiveEvent(const OHOS::Ev
     const auto action = event.GetWant().GetAction();
     auto accountManager = LocationAccountManager::GetInstance();
     LBSLOGD(ACCOUNT_MANAGER, "action = %{public}s, userId = %{public}d", action.c_str(), userId);
+    // every account event may change the active ids, drop the process-wide copy first
+    ActiveAccountCache::GetInstance()->Invalidate();
     if (action == OHOS::EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED) {
         accountManager->OnUserSwitch(userId);
     } else if (action == OHOS::EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED) {
@@ -124,11 +138,12 @@ bool LocationAccountManager::UserSwitchSubscriber::Subscribe()
     LBSLOGD(ACCOUNT_MANAGER, "subscribe common event");
     std::unique_lock lock(accountMutex_);
     OHOS::EventFwk::MatchingSkills matchingSkills;
-    matchingSkills.AddEvent(OHOS::EventFwk::CommonEventSupport::COMMON_EVENT_USER_SWITCHED);
+    AddAccountEvents(matchingSkills);
     OHOS::EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
     std::shared_ptr<UserSwitchSubscriber> subscriber = std::make_shared<UserSwitchSubscriber>(subscriberInfo);
     bool result = OHOS::EventFwk::CommonEventManager::SubscribeCommonEvent(subscriber);
     if (result) {
+        ActiveAccountCache::GetInstance()->SetEventDriven(true);
     } else {
         LBSLOGE(ACCOUNT_MANAGER, "Subscribe service event error.");
     }
@@ -152,6 +167,9 @@ void LocationAccountManager::SystemAbilityStatusChangeListener::OnAddSystemAbili
         return;
     }
     bool result = OHOS::EventFwk::CommonEventManager::SubscribeCommonEvent(subscriber_);
+    if (result) {
+        ActiveAccountCache::GetInstance()->SetEventDriven(true);
+    }
     LBSLOGI(ACCOUNT_MANAGER, "SubscribeCommonEvent subscriber_ result = %{public}d", result);
 }
 
@@ -167,6 +185,8 @@ void LocationAccountManager::SystemAbilityStatusChangeListener::OnRemoveSystemAb
         LBSLOGE(ACCOUNT_MANAGER, "OnRemoveSystemAbility subscribeer is nullptr");
         return;
     }
+    // account events can no longer be received, fall back to querying the account service
+    ActiveAccountCache::GetInstance()->SetEventDriven(false);
     bool result = OHOS::EventFwk::CommonEventManager::UnSubscribeCommonEvent(subscriber_);
     LBSLOGE(ACCOUNT_MANAGER, "UnSubscribeCommonEvent subscriber_ result = %{public}d", result);
 }
@@ -33,6 +33,12 @@ const int MAX_SIZE = 100;
 const char* LOCATION_PRIVACY_MODE = "persist.location.privacy_mode";
 constexpr const char* LOCATION_GNSS_ENABLE_STATE = "persist.location.gnss_enable_state";
 constexpr const char* LOCATION_NLP_ENABLE_STATE = "persist.location.nlp_enable_state";
+constexpr const char* LOCATION_NLP_DISCONNECT_MIN_MS = "persist.location.nlp_disconnect_min_ms";
+constexpr const char* LOCATION_NLP_DISCONNECT_MAX_MS = "persist.location.nlp_disconnect_max_ms";
+const int DEFAULT_NLP_DISCONNECT_MIN_MS = 5 * 1000;
+const int DEFAULT_NLP_DISCONNECT_MAX_MS = 60 * 1000;
+constexpr const char* LOCATION_GEOCODE_CACHE_CAPACITY = "persist.location.geocode_cache_capacity";
+const int DEFAULT_GEOCODE_CACHE_CAPACITY = 2000;
 LocationConfigManager* LocationConfigManager::GetInstance()
 {
     static LocationConfigManager gLocationConfigManager;
@@ -258,6 +264,34 @@ int LocationConfigManager::GetNlpEnableState()
     return nlpEnableState;
 }
 
+int LocationConfigManager::GetNlpDisconnectMinMs()
+{
+    int minMs = GetIntParameter(LOCATION_NLP_DISCONNECT_MIN_MS);
+    if (minMs == UNKNOW_ERROR) {
+        return DEFAULT_NLP_DISCONNECT_MIN_MS;
+    }
+    return minMs;
+}
+
+int LocationConfigManager::GetNlpDisconnectMaxMs()
+{
+    int maxMs = GetIntParameter(LOCATION_NLP_DISCONNECT_MAX_MS);
+    if (maxMs == UNKNOW_ERROR) {
+        return DEFAULT_NLP_DISCONNECT_MAX_MS;
+    }
+    return maxMs;
+}
+
+int LocationConfigManager::GetGeocodeCacheCapacity()
+{
+    int capacity = GetIntParameter(LOCATION_GEOCODE_CACHE_CAPACITY);
+    // UNKNOW_ERROR and any other value that is not a valid capacity fall back to the default
+    if (capacity <= 0) {
+        return DEFAULT_GEOCODE_CACHE_CAPACITY;
+    }
+    return capacity;
+}
+
 int LocationConfigManager::SetLocationSwitchState(int state)
 {
     std::unique_lock<std::mutex> lock(mutex_);
@@ -37,6 +37,7 @@
 #include "fusion_fence_ability.h"
 #endif
 #include "hook_utils.h"
+#include "local_location_reporter.h"
 #include "locator_background_proxy.h"
 #include "location_config_manager.h"
 #include "location_data_rdb_helper.h"
@@ -111,6 +112,7 @@ const uint32_t EVENT_START_SCAN_BLUETOOTH_DEVICE = 0x0027;
 const uint32_t EVENT_STOP_SCAN_BLUETOOTH_DEVICE = 0x0028;
 const uint32_t EVENT_START_BLUETOOTH_SEARCH = 0x0029;
 const uint32_t EVENT_STOP_BLUETOOTH_SEARCH = 0x0030;
+const uint32_t EVENT_REQUEST_DEADLINE = 0x0031;
 
 const uint32_t RETRY_INTERVAL_UNITE = 1000;
 const uint32_t RETRY_INTERVAL_OF_INIT_REQUEST_MANAGER = 5 * RETRY_INTERVAL_UNITE;
@@ -209,6 +211,7 @@ void LocatorAbility::OnStop()
 {
     state_ = ServiceRunningState::STATE_NOT_START;
     registerToAbility_ = false;
+    LocalLocationReporter::GetInstance()->UnregisterReporter();
     if (!LocationDataRdbManager::SetLocationWorkingState(0)) {
         LBSLOGD(LOCATOR, "LocatorAbility::reset LocationWorkingState failed.");
     }
@@ -261,6 +264,7 @@ bool LocatorAbility::Init()
         return false;
     }
     UpdateSaAbility();
+    RegisterLocalLocationReporter();
     if (locatorHandler_ != nullptr) {
         locatorHandler_->SendHighPriorityEvent(EVENT_INIT_REQUEST_MANAGER, 0, RETRY_INTERVAL_OF_INIT_REQUEST_MANAGER);
         locatorHandler_->SendHighPriorityEvent(EVENT_PERIODIC_CHECK, 0, EVENT_PERIODIC_INTERVAL);
@@ -337,10 +341,20 @@ std::shared_ptr<std::map<std::string, sptr<IRemoteObject>>> LocatorAbility::GetP
     return proxyMap_;
 }
 
-void LocatorAbility::ApplyRequests(int delay)
+void LocatorAbility::ApplyRequests(int delay, bool isGlobalChange)
 {
     if (locatorHandler_ != nullptr) {
-        locatorHandler_->SendHighPriorityEvent(EVENT_APPLY_REQUIREMENTS, 0, delay * RETRY_INTERVAL_UNITE);
+        locatorHandler_->SendHighPriorityEvent(EVENT_APPLY_REQUIREMENTS, static_cast<int64_t>(isGlobalChange),
+            delay * RETRY_INTERVAL_UNITE);
+    }
+}
+
+void LocatorAbility::ScheduleRequestDeadline(int64_t delayMs)
+{
+    if (locatorHandler_ != nullptr) {
+        // only the earliest deadline is armed, it re-arms the next one when it fires
+        locatorHandler_->RemoveEvent(EVENT_REQUEST_DEADLINE);
+        locatorHandler_->SendHighPriorityEvent(EVENT_REQUEST_DEADLINE, 0, delayMs);
     }
 }
 
@@ -394,6 +408,7 @@ bool LocatorAbility::SetLocationhubStateToSyspara(int value)
 
 LocationErrCode LocatorAbility::UpdateSaAbility()
 {
+    ReportManager::GetInstance()->InvalidateAuthSnapshot();
     auto event = AppExecFwk::InnerEvent::Get(EVENT_UPDATE_SA, 0);
     if (locatorHandler_ != nullptr) {
         locatorHandler_->SendHighPriorityEvent(event);
@@ -692,8 +707,16 @@ LocationErrCode LocatorAbility::SendGnssRequest(int type, MessageParcel &data, M
 #endif
 
 ErrCode LocatorAbility::RegisterGnssStatusCallback(const sptr<IRemoteObject>& cb)
+{
+    return RegisterGnssStatusCallbackWithInterval(cb, 0);
+}
+
+ErrCode LocatorAbility::RegisterGnssStatusCallbackWithInterval(const sptr<IRemoteObject>& cb, int32_t minIntervalMs)
 {
 #ifdef FEATURE_GNSS_SUPPORT
+    if (minIntervalMs < 0) {
+        return LOCATION_ERRCODE_INVALID_PARAM;
+    }
     AppIdentity identity;
     GetAppIdentityInfo(identity);
     if (!CheckRequestAvailable(LocatorInterfaceCode::REG_LOCATING_REQUIRED_DATA_CALLBACK, identity)) {
@@ -712,6 +735,7 @@ ErrCode LocatorAbility::RegisterGnssStatusCallback(const sptr<IRemoteObject>& cb
     }
     identity.Marshalling(dataToStub);
     dataToStub.WriteRemoteObject(cb);
+    dataToStub.WriteInt32(minIntervalMs);
     return SendGnssRequest(static_cast<int>(GnssInterfaceCode::REG_GNSS_STATUS), dataToStub, replyToStub);
 #else
     return ERRCODE_SERVICE_UNAVAILABLE;
@@ -742,8 +766,16 @@ ErrCode LocatorAbility::UnregisterGnssStatusCallback(const sptr<IRemoteObject>&
 }
 
 ErrCode LocatorAbility::RegisterNmeaMessageCallback(const sptr<IRemoteObject>& cb)
+{
+    return RegisterNmeaMessageCallbackWithInterval(cb, 0);
+}
+
+ErrCode LocatorAbility::RegisterNmeaMessageCallbackWithInterval(const sptr<IRemoteObject>& cb, int32_t minIntervalMs)
 {
 #ifdef FEATURE_GNSS_SUPPORT
+    if (minIntervalMs < 0) {
+        return LOCATION_ERRCODE_INVALID_PARAM;
+    }
     AppIdentity identity;
     GetAppIdentityInfo(identity);
     if (!CheckRequestAvailable(LocatorInterfaceCode::REG_NMEA_CALLBACK_V9, identity)) {
@@ -762,6 +794,7 @@ ErrCode LocatorAbility::RegisterNmeaMessageCallback(const sptr<IRemoteObject>& c
     }
     identity.Marshalling(dataToStub);
     dataToStub.WriteRemoteObject(cb);
+    dataToStub.WriteInt32(minIntervalMs);
     return SendGnssRequest(static_cast<int>(GnssInterfaceCode::REG_NMEA), dataToStub, replyToStub);
 #else
     return ERRCODE_SERVICE_UNAVAILABLE;
@@ -1842,13 +1875,19 @@ ErrCode LocatorAbility::ReportLocation(const std::string& abilityName, const Loc
         LBSLOGE(LOCATOR, "check system permission failed, [%{private}s]", identity.ToString().c_str());
         return LOCATION_ERRCODE_PERMISSION_DENIED;
     }
+    auto loc = std::make_unique<OHOS::Location::Location>(location);
+    return ReportLocalLocation(abilityName, loc);
+}
+
+ErrCode LocatorAbility::ReportLocalLocation(const std::string& abilityName,
+    const std::unique_ptr<OHOS::Location::Location>& location)
+{
     if (requests_ == nullptr) {
         return ERRCODE_SERVICE_UNAVAILABLE;
     }
     std::unique_ptr<LocationMessage> locationMessage = std::make_unique<LocationMessage>();
     locationMessage->SetAbilityName(abilityName);
-    auto loc = std::make_unique<OHOS::Location::Location>(location);
-    locationMessage->SetLocation(loc);
+    locationMessage->SetLocation(location);
     AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::
         Get(EVENT_REPORT_LOCATION_MESSAGE, locationMessage);
     if (locatorHandler_ == nullptr || !locatorHandler_->SendEvent(event)) {
@@ -1856,12 +1895,22 @@ ErrCode LocatorAbility::ReportLocation(const std::string& abilityName, const Loc
     }
 #ifdef FEATURE_GNSS_SUPPORT
     if (abilityName == NETWORK_ABILITY) {
-        SendNetworkLocation(loc);
+        SendNetworkLocation(location);
     }
 #endif
     return ERRCODE_SUCCESS;
 }
 
+void LocatorAbility::RegisterLocalLocationReporter()
+{
+    // the sub abilities of this process skip the locator proxy and the location parcel
+    LocalLocationReporter::GetInstance()->RegisterReporter(
+        [](const std::string& abilityName, const std::shared_ptr<OHOS::Location::Location>& location) {
+            auto loc = std::make_unique<OHOS::Location::Location>(*location);
+            return static_cast<int>(LocatorAbility::GetInstance()->ReportLocalLocation(abilityName, loc));
+        });
+}
+
 ErrCode LocatorAbility::ReportLocationStatus(const sptr<ILocatorCallback>& callback, int result)
 {
     int state = DISABLED;
@@ -2152,13 +2201,14 @@ ErrCode LocatorAbility::ProxyForFreeze(const std::vector<int32_t>& pidList, bool
         return LOCATION_ERRCODE_PERMISSION_DENIED;
     }
     ProxyFreezeManager::GetInstance()->ProxyForFreeze(pidList, isProxy);
+    ReportManager::GetInstance()->InvalidateAuthSnapshot();
     LocatorRequiredDataManager::GetInstance()->HandleRefreshBluetoothRequest();
     if (GetActiveRequestNum() <= 0) {
         LBSLOGD(LOCATOR, "no active request, do not refresh.");
         return ERRCODE_SUCCESS;
     }
     // for proxy uid update, should send message to refresh requests
-    ApplyRequests(0);
+    ApplyRequests(0, true);
     return ERRCODE_SUCCESS;
 }
 
@@ -2169,12 +2219,13 @@ ErrCode LocatorAbility::ResetAllProxy()
         return LOCATION_ERRCODE_PERMISSION_DENIED;
     }
     ProxyFreezeManager::GetInstance()->ResetAllProxy();
+    ReportManager::GetInstance()->InvalidateAuthSnapshot();
     if (GetActiveRequestNum() <= 0) {
         LBSLOGD(LOCATOR, "no active request, do not refresh.");
         return ERRCODE_SUCCESS;
     }
     // for proxy uid update, should send message to refresh requests
-    ApplyRequests(0);
+    ApplyRequests(0, true);
     return ERRCODE_SUCCESS;
 }
 
@@ -2644,12 +2695,12 @@ void LocatorAbility::SetLocationSwitchIgnoredFlag(uint32_t tokenId, bool enable)
     appSwitchIgnoredState.timeSinceBoot = CommonUtils::GetSinceBootTime();
     if (enable) {
         locationSettingsIgnoredFlagMap_[tokenId] = appSwitchIgnoredState;
-        ApplyRequests(LOCATION_SWITCH_IGNORED_STATE_VALID_TIME / MILLI_PER_SEC);
+        ApplyRequests(LOCATION_SWITCH_IGNORED_STATE_VALID_TIME / MILLI_PER_SEC, true);
     } else {
         auto iter = locationSettingsIgnoredFlagMap_.find(tokenId);
         if (iter != locationSettingsIgnoredFlagMap_.end()) {
             locationSettingsIgnoredFlagMap_.erase(iter);
-            ApplyRequests(0);
+            ApplyRequests(0, true);
         }
     }
 }
@@ -3219,6 +3270,8 @@ void LocatorHandler::InitLocatorHandlerEventMap()
         [this](const AppExecFwk::InnerEvent::Pointer& event) { InitMonitorManagerEvent(event); };
     locatorHandlerEventMap_[EVENT_IS_STAND_BY] =
         [this](const AppExecFwk::InnerEvent::Pointer& event) { IsStandByEvent(event); };
+    locatorHandlerEventMap_[EVENT_REQUEST_DEADLINE] =
+        [this](const AppExecFwk::InnerEvent::Pointer& event) { RequestDeadlineEvent(event); };
     ConstructDbHandleMap();
     ConstructGeocodeHandleMap();
     ConstructBluetoothScanHandleMap();
@@ -3346,6 +3399,10 @@ void LocatorHandler::ApplyRequirementsEvent(const AppExecFwk::InnerEvent::Pointe
 {
     auto requestManager = RequestManager::GetInstance();
     if (requestManager != nullptr) {
+        if (event->GetParam() != 0) {
+            // a global change (switch, permission, user, freeze...) may change the verdict of every request
+            requestManager->InvalidateWorkRecord();
+        }
         requestManager->HandleRequest();
     }
 }
@@ -3648,6 +3705,14 @@ void LocatorHandler::IsStandByEvent(const AppExecFwk::InnerEvent::Pointer& event
     }
 }
 
+void LocatorHandler::RequestDeadlineEvent(const AppExecFwk::InnerEvent::Pointer& event)
+{
+    auto requestManager = RequestManager::GetInstance();
+    if (requestManager != nullptr) {
+        requestManager->HandleRequestDeadline();
+    }
+}
+
 void LocatorHandler::SetLocationWorkingStateEvent(const AppExecFwk::InnerEvent::Pointer& event)
 {
     if (!LocationDataRdbManager::SetLocationWorkingState(0)) {
@@ -3665,7 +3730,7 @@ void LocatorHandler::SetSwitchStateToDbEvent(const AppExecFwk::InnerEvent::Point
     auto locatorAbility = LocatorAbility::GetInstance();
     if (locatorAbility != nullptr) {
         locatorAbility->UpdateSaAbility();
-        locatorAbility->ApplyRequests(0);
+        locatorAbility->ApplyRequests(0, true);
         bool isEnabled = (modeValue == ENABLED);
         std::string state = isEnabled ? "enable" : "disable";
         locatorAbility->ReportDataToResSched(state);
@@ -3686,7 +3751,7 @@ void LocatorHandler::SetSwitchStateToDbForUserEvent(const AppExecFwk::InnerEvent
         return;
     }
     LocatorAbility::GetInstance()->UpdateSaAbility();
-    LocatorAbility::GetInstance()->ApplyRequests(0);
+    LocatorAbility::GetInstance()->ApplyRequests(0, true);
     int currentUserId = 0;
     if (CommonUtils::GetCurrentUserId(currentUserId) && userId != currentUserId) {
         return;
@@ -257,7 +257,7 @@ void LocatorBackgroundProxy::OnUserSwitch(int32_t userId)
     UpdateListOnUserSwitch(userId);
     auto locatorAbility = LocatorAbility::GetInstance();
     if (locatorAbility != nullptr) {
-        locatorAbility->ApplyRequests(0);
+        locatorAbility->ApplyRequests(0, true);
     }
     HookUtils::ExecuteHookWhenOnUserSwitch(userId);
 }
@@ -17,6 +17,8 @@
 
 #include "location_log.h"
 #include "locator_ability.h"
+#include "permission_manager.h"
+#include "report_manager.h"
 
 namespace OHOS {
 namespace Location {
@@ -24,7 +26,9 @@ void PermissionStatusChangeCb::PermStateChangeCallback(PermStateChangeInfo& resu
 {
     auto locatorAbility = LocatorAbility::GetInstance();
     LBSLOGD(LOCATOR, "%{public}s changed.", result.permissionName.c_str());
-    locatorAbility->ApplyRequests(1);
+    ReportManager::GetInstance()->InvalidateAuthSnapshot();
+    PermissionManager::InvalidatePermissionState();
+    locatorAbility->ApplyRequests(1, true);
 }
 } // namespace Location
 } // namespace OHOS
\ No newline at end of file
@@ -55,6 +55,11 @@ ReportManager::ReportManager()
     clock_gettime(CLOCK_REALTIME, &lastUpdateTime_);
     offsetRandom_ = CommonUtils::DoubleRandom(0, 1);
     lastResetRecordTime_ = CommonUtils::GetSinceBootTime();
+    authSnapshotGeneration_ = 1;
+    authSnapshotHitCount_ = 0;
+    cacheGnssLocation_ = std::make_shared<const Location>();
+    cacheNlpLocation_ = std::make_shared<const Location>();
+    lastLocationsMap_ = std::make_shared<const std::map<int, std::shared_ptr<const Location>>>();
 }
 
 ReportManager::~ReportManager() {}
@@ -102,7 +107,7 @@ bool ReportManager::OnReportLocation(const std::unique_ptr<Location>& location,
         }
     }
     if (deadRequests->size() > 0) {
-        locatorAbility->ApplyRequests(1);
+        locatorAbility->ApplyRequests(1, false);
         deadRequests->clear();
     }
     return true;
@@ -134,7 +139,7 @@ bool ReportManager::ProcessRequestForReport(std::shared_ptr<Request>& request,
     if (IsRequestFuse(request)) {
         if (request->GetBestLocation() == nullptr ||
             request->GetBestLocation()->GetLocationSourceType() == 0) {
-            request->SetBestLocation(std::make_unique<Location>(GetCacheGnssLocation()));
+            request->SetBestLocation(std::make_unique<Location>(*GetCacheGnssLocation()));
         }
         fuseLocation = FusionController::GetInstance()->GetFuseLocation(location, request->GetBestLocation());
         if (request->GetLastLocation() != nullptr && request->GetLastLocation()->LocationEqual(fuseLocation)) {
@@ -143,22 +148,10 @@ bool ReportManager::ProcessRequestForReport(std::shared_ptr<Request>& request,
         NeedUpdateTimeStamp(fuseLocation, request);
         request->SetBestLocation(fuseLocation);
     }
-    if (LocationDataRdbManager::QuerySwitchStateWithUid(request->GetUid()) != ENABLED &&
-        !LocatorAbility::GetInstance()->GetLocationSwitchIgnoredFlag(request->GetTokenId())) {
-        LBSLOGE(REPORT_MANAGER, "QuerySwitchState is DISABLED");
-        return false;
-    }
-    auto locatorAbility = LocatorAbility::GetInstance();
-    finalLocation = GetPermittedLocation(request, IsRequestFuse(request) ? fuseLocation : location);
-    if (!ResultCheck(finalLocation, request)) {
-        // add location permission using record
-        int permUsedType = request->GetPermUsedType();
-        locatorAbility->UpdatePermissionUsedRecord(request->GetTokenId(),
-            ACCESS_APPROXIMATELY_LOCATION, permUsedType, 0, 1);
+    finalLocation = GetAuthorizedLocation(request, IsRequestFuse(request) ? fuseLocation : location);
+    if (finalLocation == nullptr) {
         return false;
     }
-    LocationReportDelayTimeCheck(finalLocation, request);
-    UpdateLocationByRequest(request->GetTokenId(), request->GetTokenIdEx(), finalLocation);
     finalLocation = ExecuteReportProcess(request, finalLocation, abilityName);
     if (finalLocation == nullptr) {
         LBSLOGE(REPORT_MANAGER, "%{public}s no need report location", __func__);
@@ -181,6 +174,66 @@ bool ReportManager::ProcessRequestForReport(std::shared_ptr<Request>& request,
     return true;
 }
 
+std::unique_ptr<Location> ReportManager::GetAuthorizedLocation(std::shared_ptr<Request>& request,
+    const std::unique_ptr<Location>& location)
+{
+    auto locatorAbility = LocatorAbility::GetInstance();
+    uint64_t generation = authSnapshotGeneration_.load();
+    int permissionLevel = PERMISSION_INVALID;
+    bool isSystemApp = false;
+    std::unique_ptr<Location> finalLocation;
+    if (request->GetAuthSnapshot(generation, permissionLevel, isSystemApp)) {
+        authSnapshotHitCount_++;
+        // switch, account, background, freeze and permission state are unchanged since the snapshot was taken
+        finalLocation = GetLocationByPermissionLevel(request, location, permissionLevel);
+        if (!ResultCheckByPermissionLevel(finalLocation, request, permissionLevel)) {
+            // add location permission using record
+            locatorAbility->UpdatePermissionUsedRecord(request->GetTokenId(),
+                ACCESS_APPROXIMATELY_LOCATION, request->GetPermUsedType(), 0, 1);
+            return nullptr;
+        }
+        LocationReportDelayTimeCheck(finalLocation, request);
+        finalLocation->SetIsSystemApp(isSystemApp ? 1 : 0);
+        return finalLocation;
+    }
+    bool isSwitchOn = LocationDataRdbManager::QuerySwitchStateWithUid(request->GetUid()) == ENABLED;
+    if (!isSwitchOn && !locatorAbility->GetLocationSwitchIgnoredFlag(request->GetTokenId())) {
+        LBSLOGE(REPORT_MANAGER, "QuerySwitchState is DISABLED");
+        return nullptr;
+    }
+    finalLocation = GetPermittedLocation(request, location);
+    if (!ResultCheck(finalLocation, request)) {
+        // add location permission using record
+        locatorAbility->UpdatePermissionUsedRecord(request->GetTokenId(),
+            ACCESS_APPROXIMATELY_LOCATION, request->GetPermUsedType(), 0, 1);
+        return nullptr;
+    }
+    LocationReportDelayTimeCheck(finalLocation, request);
+    UpdateLocationByRequest(request->GetTokenId(), request->GetTokenIdEx(), finalLocation);
+    // the switch ignored flag expires silently, so only a real switch-on state may be cached
+    if (isSwitchOn && IsAuthSnapshotCacheable(request)) {
+        request->SetAuthSnapshot(generation,
+            PermissionManager::GetPermissionLevel(request->GetTokenId(), request->GetFirstTokenId()),
+            finalLocation->GetIsSystemApp() == 1);
+    }
+    return finalLocation;
+}
+
+bool ReportManager::IsAuthSnapshotCacheable(const std::shared_ptr<Request>& request)
+{
+    if (request->GetRequestConfig()->GetFixNumber() != 0 ||
+        PermissionManager::CheckBackgroundPermission(request->GetTokenId(), request->GetFirstTokenId())) {
+        return true;
+    }
+    // continuous task and form visibility have no change notification, only trust the observed foreground state
+    return AppBackgroundStatusManager::GetInstance()->IsAppForeground(request->GetUid());
+}
+
+void ReportManager::InvalidateAuthSnapshot()
+{
+    authSnapshotGeneration_++;
+}
+
 bool ReportManager::ReportLocationByCallback(std::shared_ptr<Request>& request,
     const std::unique_ptr<Location>& finalLocation)
 {
@@ -235,6 +288,9 @@ void ReportManager::LocationReportDelayTimeCheck(const std::unique_ptr<Location>
 std::unique_ptr<Location> ReportManager::ExecuteReportProcess(std::shared_ptr<Request>& request,
     std::unique_ptr<Location>& location, std::string abilityName)
 {
+    if (!HookUtils::HasHook(LocationProcessStage::LOCATOR_SA_LOCATION_REPORT_PROCESS)) {
+        return std::move(location);
+    }
     LocationSupplicantInfo reportStruct;
     reportStruct.request = *request;
     reportStruct.location = *location;
@@ -250,6 +306,10 @@ std::unique_ptr<Location> ReportManager::ExecuteReportProcess(std::shared_ptr<Re
 
 bool ReportManager::CheckIfGnssAbnormal(const std::unique_ptr<Location>& location)
 {
+    if (!HookUtils::HasHook(LocationProcessStage::ON_LOCATION_REPORT_PROCESS)) {
+        location->RemoveNlpStatus();
+        return false;
+    }
     GnssLocationValidStruct reportStruct;
     reportStruct.location = *location;
     reportStruct.isGnssSpoofed = false;
@@ -265,6 +325,9 @@ bool ReportManager::CheckIfGnssAbnormal(const std::unique_ptr<Location>& locatio
 std::unique_ptr<Location> ReportManager::ExecuteLocationProcess(const std::shared_ptr<Request>& request,
     const std::unique_ptr<Location>& location)
 {
+    if (!HookUtils::HasHook(LocationProcessStage::LOCATION_REPORT_PROCESS)) {
+        return std::make_unique<Location>(*location);
+    }
     LocationSupplicantInfo reportStruct;
     reportStruct.request = *request;
     reportStruct.location = *location;
@@ -325,6 +388,19 @@ std::unique_ptr<Location> ReportManager::GetPermittedLocation(const std::shared_
     return nullptr;
 }
 
+std::unique_ptr<Location> ReportManager::GetLocationByPermissionLevel(const std::shared_ptr<Request>& request,
+    const std::unique_ptr<Location>& location, int permissionLevel)
+{
+    if (location == nullptr) {
+        return nullptr;
+    }
+    std::unique_ptr<Location> finalLocation = ExecuteLocationProcess(request, location);
+    if (permissionLevel == PERMISSION_ACCURATE) {
+        return finalLocation;
+    }
+    return ApproximatelyLocation(location, request);
+}
+
 bool ReportManager::ReportRemoteCallback(const sptr<ILocatorCallback>& locatorCallback, int type, int result)
 {
     switch (type) {
@@ -353,6 +429,15 @@ bool ReportManager::ResultCheck(const std::unique_ptr<Location>& location,
         return false;
     }
     int permissionLevel = PermissionManager::GetPermissionLevel(request->GetTokenId(), request->GetFirstTokenId());
+    return ResultCheckByPermissionLevel(location, request, permissionLevel);
+}
+
+bool ReportManager::ResultCheckByPermissionLevel(const std::unique_ptr<Location>& location,
+    const std::shared_ptr<Request>& request, int permissionLevel)
+{
+    if (request == nullptr || location == nullptr) {
+        return false;
+    }
     if (request->GetLastLocation() == nullptr || request->GetRequestConfig() == nullptr) {
         return true;
     }
@@ -414,67 +499,79 @@ void ReportManager::UpdateLastLocation(const std::unique_ptr<Location>& location
 {
     auto locatorAccountManager = LocationAccountManager::GetInstance();
     std::vector<int> activeIds = locatorAccountManager->GetActiveUserIds();
+    auto lastLocation = std::make_shared<const Location>(*location);
+    // writers are serialized by the mutex, readers only load the published map
     std::unique_lock<std::mutex> lock(lastLocationMutex_);
+    auto lastLocationsMap = std::make_shared<std::map<int, std::shared_ptr<const Location>>>(
+        *std::atomic_load(&lastLocationsMap_));
     for (int userId : activeIds) {
-        lastLocationsMap_[userId] = std::make_shared<Location>(*location);
+        (*lastLocationsMap)[userId] = lastLocation;
     }
+    std::atomic_store(&lastLocationsMap_,
+        std::shared_ptr<const std::map<int, std::shared_ptr<const Location>>>(std::move(lastLocationsMap)));
 }
 
-void ReportManager::UpdateCacheGnssLocation(Location& location)
+void ReportManager::UpdateCacheGnssLocation(const Location& location)
 {
-    std::unique_lock<std::mutex> lock(cacheGnssLocationMutex_);
-    cacheGnssLocation_ = location;
+    auto snapshot = std::make_shared<const Location>(location);
+    std::atomic_store(&cacheGnssLocation_, snapshot);
 }
 
-void ReportManager::UpdateCacheNlpLocation(Location& location)
+void ReportManager::UpdateCacheNlpLocation(const Location& location)
 {
+    // writers are serialized by the mutex, readers only load the published snapshot
     std::unique_lock<std::mutex> lock(cacheNlpLocationMutex_);
-    if (location.GetLocationSourceType() == INDOOR_TYPE) {
-        cacheNlpLocation_ = location;
+    bool isIndoor = location.GetLocationSourceType() == LocationSourceType::INDOOR_TYPE;
+    if (!isIndoor && isCacheNlpFromIndoor_) {
+        auto current = std::atomic_load(&cacheNlpLocation_);
+        if ((location.GetTimeSinceBoot() / NANOS_PER_MILLI -
+            current->GetTimeSinceBoot() / NANOS_PER_MILLI) < MAX_INDOOR_LOCATION_COMPARISON_MS) {
+            return;
+        }
+    }
+    auto snapshot = std::make_shared<Location>(location);
+    if (isIndoor) {
         std::vector<std::string> addition;
-        auto additionsMap = cacheNlpLocation_.GetAdditionsMap();
+        auto additionsMap = snapshot->GetAdditionsMap();
         auto it = additionsMap.find("requestId");
         if (it != additionsMap.end()) {
             addition.push_back(it->first + ":" + it->second);
         }
-        cacheNlpLocation_.SetAdditions(addition, false);
-        cacheNlpLocation_.SetAdditionSize(1);
-        return;
-    } else if ((cacheNlpLocation_.GetLocationSourceType() == LocationSourceType::INDOOR_TYPE) &&
-        ((location.GetTimeSinceBoot() / NANOS_PER_MILLI -
-        cacheNlpLocation_.GetTimeSinceBoot() / NANOS_PER_MILLI) < MAX_INDOOR_LOCATION_COMPARISON_MS)) {
-        return;
+        snapshot->SetAdditions(addition, false);
+        snapshot->SetAdditionSize(1);
+        // indoor fixes are reported as network locations
+        snapshot->SetLocationSourceType(LocationSourceType::NETWORK_TYPE);
     }
-    cacheNlpLocation_ = location;
+    isCacheNlpFromIndoor_ = isIndoor;
+    std::atomic_store(&cacheNlpLocation_, std::shared_ptr<const Location>(std::move(snapshot)));
 }
 
-Location& ReportManager::GetCacheGnssLocation()
+std::shared_ptr<const Location> ReportManager::GetCacheGnssLocation()
 {
-    std::unique_lock<std::mutex> lock(cacheGnssLocationMutex_);
-    return cacheGnssLocation_;
+    return std::atomic_load(&cacheGnssLocation_);
 }
 
-std::shared_ptr<Location> ReportManager::GetCacheNlpLocation()
+std::shared_ptr<const Location> ReportManager::GetCacheNlpLocation()
 {
-    std::unique_lock<std::mutex> lock(cacheNlpLocationMutex_);
-    auto location = std::make_shared<Location>(cacheNlpLocation_);
-    if (location->GetLocationSourceType() == LocationSourceType::INDOOR_TYPE) {
-        location->SetLocationSourceType(LocationSourceType::NETWORK_TYPE);
-    }
-    return location;
+    return std::atomic_load(&cacheNlpLocation_);
+}
+
+bool ReportManager::IsCacheLocationInTime(const std::shared_ptr<const Location>& location,
+    int64_t curTime, int cachedTime)
+{
+    return location != nullptr && !CommonUtils::DoubleEqual(location->GetLatitude(), MIN_LATITUDE - 1) &&
+        (curTime - location->GetTimeStamp() / MILLI_PER_SEC) <= cachedTime;
 }
 
 std::unique_ptr<Location> ReportManager::GetLastLocationByUserId(int userId)
 {
-    std::unique_lock<std::mutex> lock(lastLocationMutex_);
-    auto iter = lastLocationsMap_.find(userId);
-    if (iter == lastLocationsMap_.end()) {
+    auto lastLocationsMap = std::atomic_load(&lastLocationsMap_);
+    auto iter = lastLocationsMap->find(userId);
+    if (iter == lastLocationsMap->end() || iter->second == nullptr ||
+        CommonUtils::DoubleEqual(iter->second->GetLatitude(), MIN_LATITUDE - 1)) {
         return nullptr;
     }
     std::unique_ptr<Location> lastLocation = std::make_unique<Location>(*(iter->second));
-    if (CommonUtils::DoubleEqual(lastLocation->GetLatitude(), MIN_LATITUDE - 1)) {
-        return nullptr;
-    }
     PoiInfoManager::GetInstance()->UpdateLocationPoiInfo(lastLocation);
     return lastLocation;
 }
@@ -486,13 +583,15 @@ std::unique_ptr<Location> ReportManager::GetCacheLocation(const std::shared_ptr<
     std::string packageName = request->GetPackageName();
     int cachedTime = CACHED_TIME;
     cachedTime = HookUtils::ExecuteHookReportManagerGetCacheLocation(packageName, request->GetNlpRequestType());
-    if (!CommonUtils::DoubleEqual(GetCacheGnssLocation().GetLatitude(), MIN_LATITUDE - 1) &&
-        (curTime - GetCacheGnssLocation().GetTimeStamp() / MILLI_PER_SEC) <= cachedTime) {
-        cacheLocation = std::make_unique<Location>(GetCacheGnssLocation());
-    } else if (GetCacheNlpLocation() != nullptr &&
-        !CommonUtils::DoubleEqual(GetCacheNlpLocation()->GetLatitude(), MIN_LATITUDE - 1) &&
-        (curTime - GetCacheNlpLocation()->GetTimeStamp() / MILLI_PER_SEC) <= cachedTime) {
-        cacheLocation = std::make_unique<Location>(*GetCacheNlpLocation());
+    // each cache is loaded once, so the whole decision is made on a consistent snapshot
+    auto gnssSnapshot = GetCacheGnssLocation();
+    if (IsCacheLocationInTime(gnssSnapshot, curTime, cachedTime)) {
+        cacheLocation = std::make_unique<Location>(*gnssSnapshot);
+    } else {
+        auto nlpSnapshot = GetCacheNlpLocation();
+        if (IsCacheLocationInTime(nlpSnapshot, curTime, cachedTime)) {
+            cacheLocation = std::make_unique<Location>(*nlpSnapshot);
+        }
     }
     std::unique_ptr<Location> finalLocation = GetPermittedLocation(request, cacheLocation);
     if (!ResultCheck(finalLocation, request)) {
@@ -628,11 +727,7 @@ bool ReportManager::IsAppBackground(std::string bundleName, uint32_t tokenId, ui
 bool ReportManager::IsCacheGnssLocationValid()
 {
     int64_t curTime = CommonUtils::GetCurrentTimeStamp();
-    if (!CommonUtils::DoubleEqual(GetCacheGnssLocation().GetLatitude(), MIN_LATITUDE - 1) &&
-        (curTime - GetCacheGnssLocation().GetTimeStamp() / MILLI_PER_SEC) <= CACHED_TIME) {
-        return true;
-    }
-    return false;
+    return IsCacheLocationInTime(GetCacheGnssLocation(), curTime, CACHED_TIME);
 }
 
 bool ReportManager::NeedUpdateTimeStamp(std::unique_ptr<Location>& fuseLocation,
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "request_deadline_queue.h"
+
+namespace OHOS {
+namespace Location {
+RequestDeadlineQueue::RequestDeadlineQueue()
+{
+}
+
+RequestDeadlineQueue::~RequestDeadlineQueue()
+{
+}
+
+bool RequestDeadlineQueue::Push(const std::shared_ptr<Request>& request, int64_t deadline)
+{
+    if (request == nullptr) {
+        return false;
+    }
+    std::unique_lock<ffrt::mutex> lock(deadlineMutex_);
+    int64_t lastNextDeadline = deadlines_.empty() ? INVALID_REQUEST_DEADLINE : deadlines_.begin()->first;
+    RemoveLocked(request);
+    deadlines_.emplace(deadline, request);
+    deadlineIndex_[request] = deadline;
+    return deadlines_.begin()->first != lastNextDeadline;
+}
+
+bool RequestDeadlineQueue::Remove(const std::shared_ptr<Request>& request)
+{
+    std::unique_lock<ffrt::mutex> lock(deadlineMutex_);
+    if (deadlineIndex_.find(request) == deadlineIndex_.end()) {
+        return false;
+    }
+    RemoveLocked(request);
+    return true;
+}
+
+void RequestDeadlineQueue::RemoveLocked(const std::shared_ptr<Request>& request)
+{
+    auto iter = deadlineIndex_.find(request);
+    if (iter == deadlineIndex_.end()) {
+        return;
+    }
+    deadlines_.erase(std::make_pair(iter->second, request));
+    deadlineIndex_.erase(iter);
+}
+
+std::vector<std::shared_ptr<Request>> RequestDeadlineQueue::PopExpired(int64_t now)
+{
+    std::vector<std::shared_ptr<Request>> expiredRequests;
+    std::unique_lock<ffrt::mutex> lock(deadlineMutex_);
+    auto iter = deadlines_.begin();
+    while (iter != deadlines_.end() && iter->first <= now) {
+        expiredRequests.push_back(iter->second);
+        deadlineIndex_.erase(iter->second);
+        iter = deadlines_.erase(iter);
+    }
+    return expiredRequests;
+}
+
+int64_t RequestDeadlineQueue::GetNextDeadline()
+{
+    std::unique_lock<ffrt::mutex> lock(deadlineMutex_);
+    return deadlines_.empty() ? INVALID_REQUEST_DEADLINE : deadlines_.begin()->first;
+}
+
+size_t RequestDeadlineQueue::Size()
+{
+    std::unique_lock<ffrt::mutex> lock(deadlineMutex_);
+    return deadlines_.size();
+}
+} // namespace Location
+} // namespace OHOS
@@ -59,6 +59,14 @@ ffrt::mutex RequestManager::requestMutex_;
 const int MAX_LOCATION_ERROR_CALLBACK_NUM = 1000;
 const int HANDLE_GNSS_REQUEST_DELAY = 2;
 
+static int64_t GetMonotonicTimeMs()
+{
+    struct timespec times = {0, 0};
+    clock_gettime(CLOCK_MONOTONIC, &times);
+    return static_cast<int64_t>(times.tv_sec) * MILLI_PER_SEC + static_cast<int64_t>(times.tv_nsec) /
+        (NANOS_PER_MICRO * MICRO_PER_MILLI);
+}
+
 RequestManager* RequestManager::GetInstance()
 {
     static RequestManager data;
@@ -69,6 +77,7 @@ RequestManager::RequestManager()
 {
     isDeviceIdleMode_.store(false);
     isDeviceStillState_.store(false);
+    workRecordGeneration_.store(1);
     auto locatorDftManager = LocatorDftManager::GetInstance();
     if (locatorDftManager != nullptr) {
         locatorDftManager->Init();
@@ -226,6 +235,7 @@ bool RequestManager::RestorRequest(std::shared_ptr<Request> newRequest)
         std::list<std::shared_ptr<Request>> requestList;
         requestList.push_back(newRequest);
         receivers->insert(make_pair(newCallback, requestList));
+        AddRequestDeadline(newRequest);
         LBSLOGD(REQUEST_MANAGER, "add new receiver with new callback");
         return true;
     }
@@ -243,11 +253,16 @@ bool RequestManager::RestorRequest(std::shared_ptr<Request> newRequest)
         }
         if (newConfig->IsSame(*requestConfig)) {
             request->SetRequestConfig(*newConfig);
+            // the request may have expired before, the new configuration restarts it
+            request->SetRequesting(true);
+            InvalidateWorkRecord(request);
+            AddRequestDeadline(request);
             LBSLOGI(REQUEST_MANAGER, "find same type request, update request configuration");
             return false;
         }
     }
     requestWithSameCallback->push_back(newRequest);
+    AddRequestDeadline(newRequest);
     LBSLOGD(REQUEST_MANAGER, "add new receiver with old callback");
     return true;
 }
@@ -383,6 +398,7 @@ void RequestManager::DeleteRequestRecord(std::shared_ptr<std::list<std::shared_p
 {
     for (auto iter = requests->begin(); iter != requests->end(); ++iter) {
         auto request = *iter;
+        requestDeadlineQueue_.Remove(request);
         UpdateRequestRecord(request, false);
         UpdateUsingPermission(request, false);
         if (request->GetLocatorCallBack() != nullptr && request->GetLocatorCallbackRecipient() != nullptr) {
@@ -412,16 +428,78 @@ void RequestManager::HandleRequest()
     }
 }
 
+void RequestManager::InvalidateWorkRecord()
+{
+    workRecordGeneration_.fetch_add(1);
+}
+
+void RequestManager::InvalidateWorkRecord(const std::shared_ptr<Request>& request)
+{
+    std::unique_lock<ffrt::mutex> lock(workRecordEvaluationMutex_);
+    for (auto iter = workRecordEvaluationMap_.begin(); iter != workRecordEvaluationMap_.end(); ++iter) {
+        iter->second.erase(request);
+    }
+}
+
+void RequestManager::InvalidateWorkRecordByUid(int32_t uid)
+{
+    std::unique_lock<ffrt::mutex> lock(workRecordEvaluationMutex_);
+    for (auto mapIter = workRecordEvaluationMap_.begin(); mapIter != workRecordEvaluationMap_.end(); ++mapIter) {
+        auto& evaluationMap = mapIter->second;
+        for (auto iter = evaluationMap.begin(); iter != evaluationMap.end();) {
+            if (iter->first != nullptr && iter->first->GetUid() == uid) {
+                iter = evaluationMap.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+}
+
+bool RequestManager::IsEvaluationReusable(const std::shared_ptr<Request>& request,
+    const std::map<std::shared_ptr<Request>, std::pair<uint64_t, bool>>& evaluationMap, uint64_t generation)
+{
+    auto iter = evaluationMap.find(request);
+    // an expired once_request is invalidated by its deadline, so the cached result is enough.
+    // a rejected request may become available when its app comes to foreground or unfreezes, and those
+    // changes only re-apply the requests of locating uids, so a cached rejection is never trusted
+    return iter != evaluationMap.end() && iter->second.first == generation && iter->second.second;
+}
+
 void RequestManager::HandleRequest(std::string abilityName, std::list<std::shared_ptr<Request>> list)
 {
     // generate work record, and calculate interval
     std::shared_ptr<WorkRecord> workRecord = std::make_shared<WorkRecord>();
+    // requests evaluated under the current generation keep their result, only new or changed ones are evaluated
+    uint64_t generation = workRecordGeneration_.load();
+    std::map<std::shared_ptr<Request>, std::pair<uint64_t, bool>> lastEvaluationMap;
+    std::map<std::shared_ptr<Request>, std::pair<uint64_t, bool>> evaluationMap;
+    std::unique_lock<ffrt::mutex> lock(workRecordEvaluationMutex_, std::defer_lock);
+    lock.lock();
+    lastEvaluationMap.swap(workRecordEvaluationMap_[abilityName]);
+    lock.unlock();
     for (auto iter = list.begin(); iter != list.end(); iter++) {
         auto request = *iter;
-        if (!AddRequestToWorkRecord(abilityName, request, workRecord)) {
-            WriteLocationInnerEvent(REMOVE_REQUEST, {"PackageName", request->GetPackageName(),
-                    "abilityName", abilityName, "requestAddress", request->GetUuid()});
-            UpdateUsingPermission(request, false);
+        if (request == nullptr) {
+            continue;
+        }
+        bool isAvailable = false;
+        if (IsEvaluationReusable(request, lastEvaluationMap, generation)) {
+            isAvailable = lastEvaluationMap[request].second;
+            if (isAvailable) {
+                request->SetNlpRequestType();
+                workRecord->Add(request);
+            }
+        } else {
+            isAvailable = AddRequestToWorkRecord(abilityName, request, workRecord);
+            if (!isAvailable) {
+                WriteLocationInnerEvent(REMOVE_REQUEST, {"PackageName", request->GetPackageName(),
+                        "abilityName", abilityName, "requestAddress", request->GetUuid()});
+                UpdateUsingPermission(request, false);
+            }
+        }
+        evaluationMap[request] = std::make_pair(generation, isAvailable);
+        if (!isAvailable) {
             continue;
         }
         if (!ActiveLocatingStrategies(request)) {
@@ -430,6 +508,9 @@ void RequestManager::HandleRequest(std::string abilityName, std::list<std::share
         LBSLOGD(REQUEST_MANAGER, "add pid:%{public}d uid:%{public}d %{public}s", request->GetPid(), request->GetUid(),
             request->GetPackageName().c_str());
     }
+    lock.lock();
+    workRecordEvaluationMap_[abilityName].swap(evaluationMap);
+    lock.unlock();
     LBSLOGD(REQUEST_MANAGER, "detect %{public}s ability requests(size:%{public}zu) work record:%{public}s",
         abilityName.c_str(), list.size(), workRecord->ToString().c_str());
     if (abilityName == GNSS_ABILITY && !list.empty()) {
@@ -437,7 +518,7 @@ void RequestManager::HandleRequest(std::string abilityName, std::list<std::share
         if (IsGnssDelayEligible(firstRequest, list.size())) {
             LBSLOGI(REQUEST_MANAGER, "condition matched, delay gnss 2s");
             HandleGnssRequestHaEvent();
-            LocatorAbility::GetInstance()->ApplyRequests(HANDLE_GNSS_REQUEST_DELAY);
+            LocatorAbility::GetInstance()->ApplyRequests(HANDLE_GNSS_REQUEST_DELAY, false);
             return;
         }
     }
@@ -524,10 +605,7 @@ bool RequestManager::IsRequestAvailable(std::shared_ptr<Request>& request)
         return false;
     }
     // for once_request app, if it has timed out, do not add to workRecord
-    int64_t curTime = CommonUtils::GetCurrentTime();
-    if (request->GetRequestConfig()->GetFixNumber() == 1 &&
-        fabs(curTime - request->GetRequestConfig()->GetTimeStamp()) >
-        (request->GetRequestConfig()->GetTimeOut() / MILLI_PER_SEC)) {
+    if (IsRequestTimeout(request)) {
         LBSLOGE(LOCATOR, "%{public}d has timed out.", request->GetPid());
         WriteLocationInnerEvent(LBS_REQUEST_FAIL_DETAIL, {"REQ_APP_NAME", request->GetPackageName(),"REQ_INFO",
             request->ToString().c_str(), "TRANS_ID", request->GetUuid(), "ERR_CODE",
@@ -537,6 +615,64 @@ bool RequestManager::IsRequestAvailable(std::shared_ptr<Request>& request)
     return true;
 }
 
+bool RequestManager::IsRequestTimeout(const std::shared_ptr<Request>& request)
+{
+    auto requestConfig = request->GetRequestConfig();
+    if (requestConfig == nullptr || requestConfig->GetFixNumber() != 1) {
+        return false;
+    }
+    int64_t curTime = CommonUtils::GetCurrentTime();
+    return fabs(curTime - requestConfig->GetTimeStamp()) > (requestConfig->GetTimeOut() / MILLI_PER_SEC);
+}
+
+void RequestManager::AddRequestDeadline(const std::shared_ptr<Request>& request)
+{
+    auto requestConfig = request->GetRequestConfig();
+    if (requestConfig == nullptr || requestConfig->GetFixNumber() != 1) {
+        requestDeadlineQueue_.Remove(request);
+        return;
+    }
+    // same rounding as IsRequestTimeout, the request times out once the next whole second has passed
+    int64_t deadline = (requestConfig->GetTimeStamp() + requestConfig->GetTimeOut() / MILLI_PER_SEC + 1) *
+        MILLI_PER_SEC;
+    if (requestDeadlineQueue_.Push(request, deadline)) {
+        ScheduleRequestDeadline();
+    }
+}
+
+void RequestManager::ScheduleRequestDeadline()
+{
+    int64_t nextDeadline = requestDeadlineQueue_.GetNextDeadline();
+    if (nextDeadline == INVALID_REQUEST_DEADLINE) {
+        return;
+    }
+    int64_t delay = nextDeadline - GetMonotonicTimeMs();
+    LocatorAbility::GetInstance()->ScheduleRequestDeadline(delay > 0 ? delay : 0);
+}
+
+void RequestManager::HandleRequestDeadline()
+{
+    auto expiredRequests = requestDeadlineQueue_.PopExpired(GetMonotonicTimeMs());
+    bool needHandleRequest = false;
+    for (auto& request : expiredRequests) {
+        if (!request->GetIsRequesting()) {
+            continue;
+        }
+        // an expired request stays in the lists until it is stopped, but is skipped without re-checking
+        request->SetRequesting(false);
+        InvalidateWorkRecord(request);
+        needHandleRequest = true;
+        LBSLOGE(LOCATOR, "%{public}d has timed out.", request->GetPid());
+        WriteLocationInnerEvent(LBS_REQUEST_FAIL_DETAIL, {"REQ_APP_NAME", request->GetPackageName(), "REQ_INFO",
+            request->ToString().c_str(), "TRANS_ID", request->GetUuid(), "ERR_CODE",
+            std::to_string(LOCATION_ERRCODE_REQUEST_TIMEOUT)});
+    }
+    ScheduleRequestDeadline();
+    if (needHandleRequest) {
+        HandleRequest();
+    }
+}
+
 void RequestManager::IsStandby()
 {
 #ifdef DEVICE_STANDBY_ENABLE
@@ -677,11 +813,13 @@ sptr<IRemoteObject> RequestManager::GetRemoteObject(std::string abilityName)
 
 void RequestManager::HandlePowerSuspendChanged(int32_t pid, int32_t uid, int32_t state)
 {
+    // the foreground state of the app decides the background permission check of its requests
+    InvalidateWorkRecordByUid(uid);
     if (!IsUidInProcessing(uid)) {
         LBSLOGD(REQUEST_MANAGER, "Current uid : %{public}d is not locating.", uid);
         return;
     }
-    LocatorAbility::GetInstance()->ApplyRequests(1);
+    LocatorAbility::GetInstance()->ApplyRequests(1, false);
 }
 
 bool RequestManager::IsUidInProcessing(int32_t uid)
@@ -840,6 +978,7 @@ void RequestManager::SyncStillMovementState(bool state)
     isDeviceStillState_.store(state);
     newDeviceState = isDeviceStillState_.load() && isDeviceIdleMode_.load();
     if (newDeviceState != oldDeviceState) {
+        InvalidateWorkRecord();
         HandleRequest();
     }
 }
@@ -854,6 +993,7 @@ void RequestManager::SyncIdleState(bool state)
         isDeviceIdleMode_.load());
     newDeviceState = isDeviceStillState_.load() && isDeviceIdleMode_.load();
     if (newDeviceState != oldDeviceState) {
+        InvalidateWorkRecord();
         HandleRequest();
     }
 }
@@ -15,6 +15,9 @@
 
 #include "subability_common.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "if_system_ability_manager.h"
 #include "iservice_registry.h"
 #include "string_ex.h"
@@ -23,6 +26,7 @@
 #include "common_hisysevent.h"
 #include "common_utils.h"
 #include "ilocator_service.h"
+#include "local_location_reporter.h"
 #include "locationhub_ipc_interface_code.h"
 #include "location_log_event_ids.h"
 #include "app_identity.h"
@@ -90,42 +94,70 @@ int SubAbility::GetRequestNum()
     return newRecord_->Size();
 }
 
+int SubAbility::GetMinTimeInterval()
+{
+    if (newRecord_ == nullptr || newRecord_->IsEmpty()) {
+        return -1;
+    }
+    int minTimeInterval = newRecord_->GetTimeInterval(0);
+    for (int i = 1; i < newRecord_->Size(); i++) {
+        minTimeInterval = std::min(minTimeInterval, newRecord_->GetTimeInterval(i));
+    }
+    return minTimeInterval;
+}
+
 void SubAbility::HandleLocalRequest(WorkRecord &record)
 {
     HandleRemoveRecord(record);
     HandleAddRecord(record);
 }
 
+std::string SubAbility::GetRecordKey(WorkRecord &record, int index)
+{
+    // same identity as WorkRecord::Find
+    return std::to_string(record.GetUid(index)) + "," + record.GetName(index) + "," + record.GetUuid(index);
+}
+
 void SubAbility::HandleRemoveRecord(WorkRecord &newRecord)
 {
+    std::unordered_set<std::string> newKeys;
+    for (int i = 0; i < newRecord.Size(); i++) {
+        newKeys.insert(GetRecordKey(newRecord, i));
+    }
+    std::unique_ptr<WorkRecord> workRecord = std::make_unique<WorkRecord>();
     for (int i = 0; i < lastRecord_->Size(); i++) {
-        int uid = lastRecord_->GetUid(i);
-        bool isFind = newRecord.Find(uid, lastRecord_->GetName(i), lastRecord_->GetUuid(i));
-        LBSLOGD(label_, "remove record isFind:%{public}d, uid:%{public}d, lastRecord:%{public}s, newRecord:%{public}s",
-            isFind, uid, lastRecord_->ToString().c_str(), newRecord.ToString().c_str());
-        if (!isFind) {
-            std::unique_ptr<WorkRecord> workRecord = std::make_unique<WorkRecord>();
+        if (newKeys.find(GetRecordKey(*lastRecord_, i)) == newKeys.end()) {
             workRecord->Add(*lastRecord_, i);
-            workRecord->SetDeviceId(newRecord.GetDeviceId());
-            RequestRecord(*workRecord, false);
         }
     }
+    LBSLOGD(label_, "remove record num:%{public}d, lastRecord num:%{public}d, newRecord num:%{public}d",
+        workRecord->Size(), lastRecord_->Size(), newRecord.Size());
+    if (workRecord->IsEmpty()) {
+        return;
+    }
+    workRecord->SetDeviceId(newRecord.GetDeviceId());
+    RequestRecord(*workRecord, false);
 }
 
 void SubAbility::HandleAddRecord(WorkRecord &newRecord)
 {
+    std::unordered_set<std::string> lastKeys;
+    for (int i = 0; i < lastRecord_->Size(); i++) {
+        lastKeys.insert(GetRecordKey(*lastRecord_, i));
+    }
+    std::unique_ptr<WorkRecord> workRecord = std::make_unique<WorkRecord>();
     for (int i = 0; i < newRecord.Size(); i++) {
-        int uid = newRecord.GetUid(i);
-        bool isFind = lastRecord_->Find(uid, newRecord.GetName(i), newRecord.GetUuid(i));
-        LBSLOGD(label_, "add record isFind:%{public}d, uid:%{public}d, lastRecord:%{public}s, newRecord:%{public}s",
-            isFind, uid, lastRecord_->ToString().c_str(), newRecord.ToString().c_str());
-        if (!isFind) {
-            std::unique_ptr<WorkRecord> workRecord = std::make_unique<WorkRecord>();
+        if (lastKeys.find(GetRecordKey(newRecord, i)) == lastKeys.end()) {
             workRecord->Add(newRecord, i);
-            workRecord->SetDeviceId(newRecord.GetDeviceId());
-            RequestRecord(*workRecord, true);
         }
     }
+    LBSLOGD(label_, "add record num:%{public}d, lastRecord num:%{public}d, newRecord num:%{public}d",
+        workRecord->Size(), lastRecord_->Size(), newRecord.Size());
+    if (workRecord->IsEmpty()) {
+        return;
+    }
+    workRecord->SetDeviceId(newRecord.GetDeviceId());
+    RequestRecord(*workRecord, true);
 }
 
 void SubAbility::Enable(bool state, const sptr<IRemoteObject> ability)
@@ -210,6 +242,9 @@ void SubAbility::ClearLocationMock()
 
 void SubAbility::ReportLocationInfo(const std::string& systemAbility, const std::shared_ptr<Location> location)
 {
+    if (LocalLocationReporter::GetInstance()->ReportLocation(systemAbility, location)) {
+        return;
+    }
     sptr<IRemoteObject> objectLocator =
         CommonUtils::GetRemoteObject(LOCATION_LOCATOR_SA_ID, CommonUtils::InitDeviceId());
     if (objectLocator == nullptr) {
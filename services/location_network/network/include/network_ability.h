@@ -17,6 +17,8 @@
 #define NETWORK_ABILITY_H
 #ifdef FEATURE_NETWORK_SUPPORT
 
+#include <map>
+#include <mutex>
 #include <string>
 #include <singleton.h>
 
@@ -29,6 +31,7 @@
 #include "common_utils.h"
 #include "constant_definition.h"
 #include "network_ability_skeleton.h"
+#include "nlp_disconnect_window.h"
 #include "subability_common.h"
 
 namespace OHOS {
@@ -54,6 +57,26 @@ private:
     NetworkEventHandleMap networkEventProcessMap_;
 };
 
+// nlp requests sharing the same nlp request type and interval are served by one request to the nlp service
+struct NlpRequestGroup {
+    std::string uuid;
+    // uid or bundleName of the member the request to the nlp service is made for
+    std::string name;
+    // uuid -> uid or bundleName of every request in the group
+    std::map<std::string, std::string> memberNames;
+    bool isRequested = false;
+};
+using NlpRequestGroupKey = std::pair<int, int64_t>;
+
+// what the nlp service has to be told after a request left its group
+struct NlpRequestGroupChange {
+    bool needRemove = false;
+    bool needRequest = false;
+    NlpRequestGroupKey key;
+    std::string uuid;
+    std::string name;
+};
+
 class NlpServiceDeathRecipient : public IRemoteObject::DeathRecipient {
 public:
     void OnRemoteDied(const wptr<IRemoteObject> &remote) override;
@@ -96,6 +119,8 @@ public:
     void RestartNlpRequests();
     void DisconnectAbilityConnect();
     void ClearServiceProxy();
+    void ReportNlpLocation(const std::shared_ptr<Location>& location);
+    void ReportNlpLocationError(int32_t errCode, const std::string& errMsg, const std::string& nlpUuid);
 private:
     bool Init();
     static void SaDumpInfo(std::string& result);
@@ -103,6 +128,11 @@ private:
     bool CheckIfNetworkConnecting();
     bool RequestNetworkLocation(WorkRecord &workRecord);
     bool RemoveNetworkLocation(WorkRecord &workRecord);
+    bool SendNlpRequest(const NlpRequestGroupKey& key, const std::string& uuid, const std::string& name);
+    bool SendNlpRemoveRequest(const std::string& uuid, const std::string& name);
+    NlpRequestGroupChange LeaveNlpRequestGroup(const std::string& uuid);
+    bool ApplyNlpRequestGroupChange(const NlpRequestGroupChange& change);
+    void ClearNlpRequestGroups();
     void RegisterNlpServiceDeathRecipient();
     void UnregisterNlpServiceDeathRecipient();
     bool IsConnect();
@@ -120,6 +150,13 @@ private:
     sptr<AAFwk::IAbilityConnection> conn_;
     std::mutex networkQosSetMapMutex_;
     std::map<pid_t, bool> networkQosSetMap_;
+    std::mutex nlpRequestGroupMutex_;
+    std::map<NlpRequestGroupKey, NlpRequestGroup> nlpRequestGroups_;
+    std::map<std::string, NlpRequestGroupKey> nlpRequestGroupKeys_;
+    // one callback host for all nlp requests, created on the first request
+    sptr<IRemoteObject> nlpCallback_;
+    // idle time before the nlp service is disconnected, adapted to the recent request arrivals
+    std::shared_ptr<NlpDisconnectWindow> disconnectWindow_;
     void SetNetworkHandlerQos();
     void ResetNetworkHandlerQos();
     void SetHandlerQos(int qosLevel);
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NLP_DISCONNECT_WINDOW_H
+#define NLP_DISCONNECT_WINDOW_H
+#ifdef FEATURE_NETWORK_SUPPORT
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace Location {
+/*
+ * Decides how long the nlp service stays connected after the last request is removed. The gaps between
+ * recent request arrivals are kept in a histogram of one second buckets, the window covers the 90th
+ * percentile gap so a periodic requester finds the service still connected. Gaps beyond the max bound
+ * would not be covered anyway, the window then falls back to the min bound.
+ */
+class NlpDisconnectWindow {
+public:
+    NlpDisconnectWindow(int64_t minWindowMs, int64_t maxWindowMs);
+    ~NlpDisconnectWindow() = default;
+    void OnRequestArrival(int64_t arrivalTimeMs);
+    int64_t GetWindowMs();
+    void OnConnected(int64_t costMs);
+    void OnDisconnected(int64_t costMs);
+    void DumpInfo(std::string& result);
+
+private:
+    int64_t CalculateWindowMs();
+    size_t GetBucketIndex(int64_t gapMs) const;
+
+    std::mutex mutex_;
+    int64_t minWindowMs_;
+    int64_t maxWindowMs_;
+    int64_t lastArrivalTime_ = 0;
+    std::deque<int64_t> recentGaps_;
+    // one bucket per second up to maxWindowMs_, the last bucket counts the longer gaps
+    std::vector<int> gapHistogram_;
+    int64_t connectCount_ = 0;
+    int64_t totalConnectCostMs_ = 0;
+    int64_t maxConnectCostMs_ = 0;
+    int64_t disconnectCount_ = 0;
+    int64_t totalDisconnectCostMs_ = 0;
+    int64_t maxDisconnectCostMs_ = 0;
+};
+}  // namespace Location
+}  // namespace OHOS
+#endif // FEATURE_NETWORK_SUPPORT
+#endif // NLP_DISCONNECT_WINDOW_H
@@ -53,19 +53,22 @@ const uint32_t EVENT_STOP_ALL_LOCATION_REQUEST = 0x0300;
 const uint32_t EVENT_DISCONNECT_SERVICES = 0x0400;
 const uint32_t EVENT_INTERVAL_UNITE = 1000;
 const uint32_t DELAY_RESTART_MS = 500;
-const uint32_t DELAY_DINCONNECT_MS = 5 * 1000;
 constexpr uint32_t WAIT_MS = 100;
 const int MAX_RETRY_COUNT = 5;
 const std::string UNLOAD_NETWORK_TASK = "network_sa_unload";
 const std::string DISCONNECT_NETWORK_TASK = "disconnect_network_ability";
 const uint32_t RETRY_INTERVAL_OF_UNLOAD_SA = 4 * 60 * EVENT_INTERVAL_UNITE;
 const int TIMEOUT_WATCHDOG = 60; // s
+const int64_t NANOS_PER_MILLI = static_cast<int64_t>(NANOS_PER_MICRO) * MICRO_PER_MILLI;
 const bool REGISTER_RESULT = NetworkAbility::MakeAndRegisterAbility(
     NetworkAbility::GetInstance());
 
 NetworkAbility::NetworkAbility() : SystemAbility(LOCATION_NETWORK_LOCATING_SA_ID, true)
 {
     SetAbility(NETWORK_ABILITY);
+    disconnectWindow_ = std::make_shared<NlpDisconnectWindow>(
+        LocationConfigManager::GetInstance()->GetNlpDisconnectMinMs(),
+        LocationConfigManager::GetInstance()->GetNlpDisconnectMaxMs());
 #ifndef TDD_CASES_ENABLED
     networkHandler_ =
         std::make_shared<NetworkHandler>(AppExecFwk::EventRunner::Create(true, AppExecFwk::ThreadMode::FFRT));
@@ -158,6 +161,7 @@ bool NetworkAbility::ConnectNlpService()
             return false;
         }
         connectionWant.SetElementName(serviceName, abilityName);
+        int64_t connectStartTime = CommonUtils::GetSinceBootTime();
         std::unique_lock<ffrt::mutex> lock(connMutex_, std::defer_lock);
         connMutex_.lock();
         conn_ = sptr<AAFwk::IAbilityConnection>(new (std::nothrow) AbilityConnection());
@@ -180,6 +184,7 @@ bool NetworkAbility::ConnectNlpService()
             LBSLOGE(NETWORK, "Connect cloudService timeout!");
             return false;
         }
+        disconnectWindow_->OnConnected((CommonUtils::GetSinceBootTime() - connectStartTime) / NANOS_PER_MILLI);
     }
     RegisterNlpServiceDeathRecipient();
     return true;
@@ -215,8 +220,11 @@ bool NetworkAbility::ResetServiceProxy()
 
 void NetworkAbility::ClearServiceProxy()
 {
-    std::unique_lock<ffrt::mutex> uniqueLock(nlpServiceMutex_);
-    nlpServiceProxy_ = nullptr;
+    {
+        std::unique_lock<ffrt::mutex> uniqueLock(nlpServiceMutex_);
+        nlpServiceProxy_ = nullptr;
+    }
+    ClearNlpRequestGroups();
 }
 
 void NetworkAbility::NotifyConnected(const sptr<IRemoteObject>& remoteObject)
@@ -356,20 +364,36 @@ void NetworkAbility::RequestRecord(WorkRecord &workRecord, bool isAdded)
     }
     if (isAdded) {
         int nlpEnableState  = LocationConfigManager::GetInstance()->GetNlpEnableState();
-        uint32_t tokenId = workRecord.GetTokenId(0);
-        uint32_t firstTokenId = workRecord.GetFirstTokenId(0);
-        bool ignoredSwtichPermission =
-            PermissionManager::CheckLocationSwitchIgnoredPermission(tokenId, firstTokenId);
-        if (!nlpEnableState && !ignoredSwtichPermission) { //  enter when enablestated & ignoredPermission all false
-            LBSLOGE(NETWORK, "enablestated and ignoredSwtichPermission both false");
-            return;
+        bool isRequested = false;
+        // the work record carries all added requests, the nlp service takes them one by one
+        for (int i = 0; i < workRecord.Size(); i++) {
+            uint32_t tokenId = workRecord.GetTokenId(i);
+            uint32_t firstTokenId = workRecord.GetFirstTokenId(i);
+            bool ignoredSwtichPermission =
+                PermissionManager::CheckLocationSwitchIgnoredPermission(tokenId, firstTokenId);
+            if (!nlpEnableState && !ignoredSwtichPermission) { //  enter when enablestated & ignoredPermission all false
+                LBSLOGE(NETWORK, "enablestated and ignoredSwtichPermission both false");
+                continue;
+            }
+            WorkRecord record;
+            record.Add(workRecord, i);
+            record.SetDeviceId(workRecord.GetDeviceId());
+            RequestNetworkLocation(record);
+            isRequested = true;
         }
-        RequestNetworkLocation(workRecord);
-        if (networkHandler_ != nullptr) {
+        if (isRequested) {
+            disconnectWindow_->OnRequestArrival(CommonUtils::GetSinceBootTime() / NANOS_PER_MILLI);
+        }
+        if (isRequested && networkHandler_ != nullptr) {
             networkHandler_->RemoveTask(DISCONNECT_NETWORK_TASK);
         }
     } else {
-        RemoveNetworkLocation(workRecord);
+        for (int i = 0; i < workRecord.Size(); i++) {
+            WorkRecord record;
+            record.Add(workRecord, i);
+            record.SetDeviceId(workRecord.GetDeviceId());
+            RemoveNetworkLocation(record);
+        }
         if (networkHandler_ == nullptr) {
             return;
         }
@@ -382,7 +406,9 @@ void NetworkAbility::RequestRecord(WorkRecord &workRecord, bool isAdded)
             };
             networkAbility->DisconnectAbilityConnect();
         };
-        networkHandler_->PostTask(disconnectTask, DISCONNECT_NETWORK_TASK, DELAY_DINCONNECT_MS);
+        int64_t disconnectDelayMs = disconnectWindow_->GetWindowMs();
+        LBSLOGD(NETWORK, "disconnect nlp service after %{public}s ms", std::to_string(disconnectDelayMs).c_str());
+        networkHandler_->PostTask(disconnectTask, DISCONNECT_NETWORK_TASK, disconnectDelayMs);
     }
 }
 
@@ -392,43 +418,159 @@ void NetworkAbility::DisconnectAbilityConnect()
     if (GetRequestNum() == 0 && conn_ != nullptr) {
         LBSLOGI(NETWORK, "RequestRecord disconnect");
         UnregisterNlpServiceDeathRecipient();
+        int64_t disconnectStartTime = CommonUtils::GetSinceBootTime();
         AAFwk::AbilityManagerClient::GetInstance()->DisconnectAbility(conn_);
+        disconnectWindow_->OnDisconnected((CommonUtils::GetSinceBootTime() - disconnectStartTime) / NANOS_PER_MILLI);
         conn_ = nullptr;
-        std::unique_lock<ffrt::mutex> uniqueLock(nlpServiceMutex_);
-        nlpServiceProxy_ = nullptr;
+        {
+            std::unique_lock<ffrt::mutex> uniqueLock(nlpServiceMutex_);
+            nlpServiceProxy_ = nullptr;
+        }
+        ClearNlpRequestGroups();
         LBSLOGD(NETWORK, "disconnect cloudService success!");
     }
 }
 
 bool NetworkAbility::RequestNetworkLocation(WorkRecord &workRecord)
 {
-    LBSLOGW(NETWORK, "start network location, uuid: %{public}s", workRecord.GetUuid(0).c_str());
-    sptr<NetworkCallbackHost> callback = new (std::nothrow) NetworkCallbackHost();
-    if (callback == nullptr) {
-        LBSLOGE(NETWORK, "can not get valid callback.");
+    std::string uuid = workRecord.GetUuid(0);
+    LBSLOGW(NETWORK, "start network location, uuid: %{public}s", uuid.c_str());
+    HookUtils::ExecuteHookWhenAddNetworkRequest(uuid);
+    NlpRequestGroupKey key = std::make_pair(workRecord.GetNlpRequestType(0),
+        static_cast<int64_t>(workRecord.GetTimeInterval(0)) * MILLI_PER_SEC);
+    std::string name = workRecord.GetName(0).size() == 0 ?
+        std::to_string(workRecord.GetUid(0)) : workRecord.GetName(0); // uid or bundleName
+    NlpRequestGroupChange leaveChange;
+    bool needRequest = false;
+    std::string groupUuid;
+    std::string groupName;
+    {
+        std::unique_lock<std::mutex> lock(nlpRequestGroupMutex_);
+        auto keyIter = nlpRequestGroupKeys_.find(uuid);
+        if (keyIter != nlpRequestGroupKeys_.end() && keyIter->second != key) {
+            // the request changed its type or interval, it leaves the old group
+            leaveChange = LeaveNlpRequestGroup(uuid);
+        }
+        nlpRequestGroupKeys_[uuid] = key;
+        NlpRequestGroup& group = nlpRequestGroups_[key];
+        if (group.uuid.empty()) {
+            group.uuid = "nlp_" + std::to_string(key.first) + "_" + std::to_string(key.second);
+            group.name = name;
+        }
+        group.memberNames[uuid] = name;
+        if (group.isRequested) {
+            LBSLOGI(NETWORK, "uuid: %{public}s joins nlp request %{public}s, %{public}zu requests in total",
+                uuid.c_str(), group.uuid.c_str(), group.memberNames.size());
+        } else {
+            group.isRequested = true;
+            needRequest = true;
+            groupUuid = group.uuid;
+            groupName = group.name;
+        }
+    }
+    ApplyNlpRequestGroupChange(leaveChange);
+    if (!needRequest || SendNlpRequest(key, groupUuid, groupName)) {
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(nlpRequestGroupMutex_);
+    auto groupIter = nlpRequestGroups_.find(key);
+    if (groupIter != nlpRequestGroups_.end()) {
+        // let the next request of the group try again
+        groupIter->second.isRequested = false;
+    }
+    return false;
+}
+
+bool NetworkAbility::RemoveNetworkLocation(WorkRecord &workRecord)
+{
+    std::string uuid = workRecord.GetUuid(0);
+    HookUtils::ExecuteHookWhenRemoveNetworkRequest(uuid);
+    LBSLOGW(NETWORK, "stop network location, uuid: %{public}s", uuid.c_str());
+    NlpRequestGroupChange change;
+    {
+        std::unique_lock<std::mutex> lock(nlpRequestGroupMutex_);
+        change = LeaveNlpRequestGroup(uuid);
+    }
+    if (!IsConnect()) {
+        LBSLOGE(NETWORK, "nlpProxy is nullptr.");
         return false;
     }
+    return ApplyNlpRequestGroupChange(change);
+}
+
+NlpRequestGroupChange NetworkAbility::LeaveNlpRequestGroup(const std::string& uuid)
+{
+    // caller holds nlpRequestGroupMutex_
+    NlpRequestGroupChange change;
+    auto keyIter = nlpRequestGroupKeys_.find(uuid);
+    if (keyIter == nlpRequestGroupKeys_.end()) {
+        return change;
+    }
+    change.key = keyIter->second;
+    auto groupIter = nlpRequestGroups_.find(keyIter->second);
+    nlpRequestGroupKeys_.erase(keyIter);
+    if (groupIter == nlpRequestGroups_.end()) {
+        return change;
+    }
+    NlpRequestGroup& group = groupIter->second;
+    group.memberNames.erase(uuid);
+    change.uuid = group.uuid;
+    if (group.memberNames.empty()) {
+        // the last request of the group is gone, so is the request to the nlp service
+        change.needRemove = group.isRequested;
+        change.name = group.name;
+        nlpRequestGroups_.erase(groupIter);
+        return change;
+    }
+    for (auto& member : group.memberNames) {
+        if (member.second == group.name) {
+            return change;
+        }
+    }
+    // the request to the nlp service is made in the name of a member, hand it over to one that stays
+    group.name = group.memberNames.begin()->second;
+    change.needRequest = group.isRequested;
+    change.name = group.name;
+    return change;
+}
+
+bool NetworkAbility::ApplyNlpRequestGroupChange(const NlpRequestGroupChange& change)
+{
+    if (change.needRemove) {
+        return SendNlpRemoveRequest(change.uuid, change.name);
+    }
+    if (change.needRequest) {
+        return SendNlpRequest(change.key, change.uuid, change.name);
+    }
+    return true;
+}
+
+bool NetworkAbility::SendNlpRequest(const NlpRequestGroupKey& key, const std::string& uuid, const std::string& name)
+{
     SetNetworkHandlerQos();
-    HookUtils::ExecuteHookWhenAddNetworkRequest(workRecord.GetUuid(0));
     std::unique_lock<ffrt::mutex> uniqueLock(nlpServiceMutex_);
     if (nlpServiceProxy_ == nullptr) {
         LBSLOGE(NETWORK, "nlpProxy is nullptr.");
         return false;
     }
+    if (nlpCallback_ == nullptr) {
+        sptr<NetworkCallbackHost> callback = new (std::nothrow) NetworkCallbackHost();
+        if (callback == nullptr) {
+            LBSLOGE(NETWORK, "can not get valid callback.");
+            return false;
+        }
+        nlpCallback_ = callback->AsObject();
+    }
+    LBSLOGI(NETWORK, "request nlp service, uuid: %{public}s", uuid.c_str());
     MessageParcel data;
-    
     MessageParcel reply;
     MessageOption option;
     data.WriteInterfaceToken(nlpServiceProxy_->GetInterfaceDescriptor());
-    data.WriteString16(Str8ToStr16(workRecord.GetUuid(0)));
-    data.WriteInt64(workRecord.GetTimeInterval(0) * MILLI_PER_SEC);
-    data.WriteInt32(workRecord.GetNlpRequestType(0));
-    data.WriteRemoteObject(callback->AsObject());
-    if (workRecord.GetName(0).size() == 0) {
-        data.WriteString16(Str8ToStr16(std::to_string(workRecord.GetUid(0)))); // uid
-    } else {
-        data.WriteString16(Str8ToStr16(workRecord.GetName(0))); // bundleName
-    }
+    data.WriteString16(Str8ToStr16(uuid));
+    data.WriteInt64(key.second);
+    data.WriteInt32(key.first);
+    data.WriteRemoteObject(nlpCallback_);
+    data.WriteString16(Str8ToStr16(name));
     int error = nlpServiceProxy_->SendRequest(REQUEST_NETWORK_LOCATION, data, reply, option);
     if (error != ERR_OK) {
         LBSLOGE(NETWORK, "SendRequest to cloud service failed. error = %{public}d", error);
@@ -437,21 +579,20 @@ bool NetworkAbility::RequestNetworkLocation(WorkRecord &workRecord)
     return true;
 }
 
-bool NetworkAbility::RemoveNetworkLocation(WorkRecord &workRecord)
+bool NetworkAbility::SendNlpRemoveRequest(const std::string& uuid, const std::string& name)
 {
-    HookUtils::ExecuteHookWhenRemoveNetworkRequest(workRecord.GetUuid(0));
     std::unique_lock<ffrt::mutex> uniqueLock(nlpServiceMutex_);
     if (nlpServiceProxy_ == nullptr) {
         LBSLOGE(NETWORK, "nlpProxy is nullptr.");
         return false;
     }
-    LBSLOGW(NETWORK, "stop network location, uuid: %{public}s", workRecord.GetUuid(0).c_str());
+    LBSLOGI(NETWORK, "remove nlp service request, uuid: %{public}s", uuid.c_str());
     MessageParcel data;
     MessageParcel reply;
     MessageOption option;
     data.WriteInterfaceToken(nlpServiceProxy_->GetInterfaceDescriptor());
-    data.WriteString16(Str8ToStr16(workRecord.GetUuid(0)));
-    data.WriteString16(Str8ToStr16(workRecord.GetName(0))); // bundleName
+    data.WriteString16(Str8ToStr16(uuid));
+    data.WriteString16(Str8ToStr16(name)); // bundleName
     int error = nlpServiceProxy_->SendRequest(REMOVE_NETWORK_LOCATION, data, reply, option);
     ResetNetworkHandlerQos();
     if (error != ERR_OK) {
@@ -461,6 +602,62 @@ bool NetworkAbility::RemoveNetworkLocation(WorkRecord &workRecord)
     return true;
 }
 
+void NetworkAbility::ClearNlpRequestGroups()
+{
+    // a new nlp service connection knows none of the groups, the restarted requests build them again
+    std::unique_lock<std::mutex> lock(nlpRequestGroupMutex_);
+    nlpRequestGroups_.clear();
+    nlpRequestGroupKeys_.clear();
+}
+
+void NetworkAbility::ReportNlpLocation(const std::shared_ptr<Location>& location)
+{
+    // the nlp service answers the group request, every request of the group gets the fix under its own uuid
+    std::vector<std::string> uuids;
+    {
+        std::unique_lock<std::mutex> lock(nlpRequestGroupMutex_);
+        for (auto& groupPair : nlpRequestGroups_) {
+            if (groupPair.second.uuid == location->GetUuid()) {
+                for (auto& member : groupPair.second.memberNames) {
+                    uuids.push_back(member.first);
+                }
+                break;
+            }
+        }
+    }
+    if (uuids.empty()) {
+        ReportLocationInfo(NETWORK_ABILITY, location);
+        return;
+    }
+    for (auto& uuid : uuids) {
+        std::shared_ptr<Location> memberLocation = std::make_shared<Location>(*location);
+        memberLocation->SetUuid(uuid);
+        ReportLocationInfo(NETWORK_ABILITY, memberLocation);
+    }
+}
+
+void NetworkAbility::ReportNlpLocationError(int32_t errCode, const std::string& errMsg, const std::string& nlpUuid)
+{
+    std::vector<std::string> uuids;
+    {
+        std::unique_lock<std::mutex> lock(nlpRequestGroupMutex_);
+        for (auto& groupPair : nlpRequestGroups_) {
+            if (groupPair.second.uuid == nlpUuid) {
+                for (auto& member : groupPair.second.memberNames) {
+                    uuids.push_back(member.first);
+                }
+                break;
+            }
+        }
+    }
+    if (uuids.empty()) {
+        uuids.push_back(nlpUuid);
+    }
+    for (auto& uuid : uuids) {
+        ReportLocationError(errCode, errMsg, uuid);
+    }
+}
+
 LocationErrCode NetworkAbility::EnableMock()
 {
     if (!EnableLocationMock()) {
@@ -535,6 +732,7 @@ void NetworkAbility::SaDumpInfo(std::string& result)
 {
     result += "Network Location enable status: false";
     result += "\n";
+    NetworkAbility::GetInstance()->disconnectWindow_->DumpInfo(result);
 }
 
 int32_t NetworkAbility::Dump(int32_t fd, const std::vector<std::u16string>& args)
@@ -51,7 +51,7 @@ int NetworkCallbackHost::OnRemoteRequest(
             auto errCode = data.ReadInt32();
             auto errMsg = Str16ToStr8(data.ReadString16());
             auto uuid = Str16ToStr8(data.ReadString16());
-            NetworkAbility::GetInstance()->ReportLocationError(errCode, errMsg, uuid);
+            NetworkAbility::GetInstance()->ReportNlpLocationError(errCode, errMsg, uuid);
             break;
         }
         default: {
@@ -75,7 +75,7 @@ void NetworkCallbackHost::OnLocationReport(const std::unique_ptr<Location>& loca
         return;
     }
     std::shared_ptr<Location> locationNew = std::make_shared<Location>(*location);
-    NetworkAbility::GetInstance()->ReportLocationInfo(NETWORK_ABILITY, locationNew);
+    networkAbility->ReportNlpLocation(locationNew);
     WriteLocationInnerEvent(NETWORK_CALLBACK_LOCATION, {"speed", std::to_string(location->GetSpeed()),
         "accuracy", std::to_string(location->GetAccuracy()),
         "locationTimestamp", std::to_string(location->GetTimeStamp() / MILLI_PER_SEC),
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef FEATURE_NETWORK_SUPPORT
+#include "nlp_disconnect_window.h"
+
+#include <algorithm>
+
+#include "location_log.h"
+
+namespace OHOS {
+namespace Location {
+namespace {
+const int64_t GAP_BUCKET_WIDTH_MS = 1000;
+const size_t MAX_RECENT_GAPS = 32;
+const size_t MIN_GAPS_FOR_ADAPTIVE_WINDOW = 3;
+const int GAP_PERCENTILE = 90;
+const int PERCENT = 100;
+}
+
+NlpDisconnectWindow::NlpDisconnectWindow(int64_t minWindowMs, int64_t maxWindowMs)
+    : minWindowMs_(std::max(minWindowMs, static_cast<int64_t>(0))),
+    maxWindowMs_(std::max(maxWindowMs, minWindowMs_))
+{
+    gapHistogram_.resize(static_cast<size_t>(maxWindowMs_ / GAP_BUCKET_WIDTH_MS) + 1, 0);
+}
+
+void NlpDisconnectWindow::OnRequestArrival(int64_t arrivalTimeMs)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    int64_t gapMs = arrivalTimeMs - lastArrivalTime_;
+    bool isFirstArrival = lastArrivalTime_ == 0;
+    lastArrivalTime_ = arrivalTimeMs;
+    if (isFirstArrival || gapMs < 0) {
+        return;
+    }
+    recentGaps_.push_back(gapMs);
+    gapHistogram_[GetBucketIndex(gapMs)]++;
+    if (recentGaps_.size() > MAX_RECENT_GAPS) {
+        gapHistogram_[GetBucketIndex(recentGaps_.front())]--;
+        recentGaps_.pop_front();
+    }
+}
+
+int64_t NlpDisconnectWindow::GetWindowMs()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return CalculateWindowMs();
+}
+
+int64_t NlpDisconnectWindow::CalculateWindowMs()
+{
+    if (recentGaps_.size() < MIN_GAPS_FOR_ADAPTIVE_WINDOW) {
+        return minWindowMs_;
+    }
+    size_t target = (recentGaps_.size() * GAP_PERCENTILE + PERCENT - 1) / PERCENT;
+    size_t accumulated = 0;
+    size_t bucket = 0;
+    for (; bucket < gapHistogram_.size(); bucket++) {
+        accumulated += static_cast<size_t>(gapHistogram_[bucket]);
+        if (accumulated >= target) {
+            break;
+        }
+    }
+    if (bucket >= gapHistogram_.size() - 1) {
+        return minWindowMs_;
+    }
+    // upper edge of the bucket, so the percentile gap itself is still covered
+    int64_t windowMs = static_cast<int64_t>(bucket + 1) * GAP_BUCKET_WIDTH_MS;
+    return std::min(std::max(windowMs, minWindowMs_), maxWindowMs_);
+}
+
+size_t NlpDisconnectWindow::GetBucketIndex(int64_t gapMs) const
+{
+    size_t index = static_cast<size_t>(gapMs / GAP_BUCKET_WIDTH_MS);
+    return std::min(index, gapHistogram_.size() - 1);
+}
+
+void NlpDisconnectWindow::OnConnected(int64_t costMs)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    connectCount_++;
+    totalConnectCostMs_ += costMs;
+    maxConnectCostMs_ = std::max(maxConnectCostMs_, costMs);
+}
+
+void NlpDisconnectWindow::OnDisconnected(int64_t costMs)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    disconnectCount_++;
+    totalDisconnectCostMs_ += costMs;
+    maxDisconnectCostMs_ = std::max(maxDisconnectCostMs_, costMs);
+}
+
+void NlpDisconnectWindow::DumpInfo(std::string& result)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    result.append("  NLP connect count: ").append(std::to_string(connectCount_))
+        .append(", avg cost: ")
+        .append(std::to_string(connectCount_ > 0 ? totalConnectCostMs_ / connectCount_ : 0))
+        .append("ms, max cost: ").append(std::to_string(maxConnectCostMs_)).append("ms\n");
+    result.append("  NLP disconnect count: ").append(std::to_string(disconnectCount_))
+        .append(", avg cost: ")
+        .append(std::to_string(disconnectCount_ > 0 ? totalDisconnectCostMs_ / disconnectCount_ : 0))
+        .append("ms, max cost: ").append(std::to_string(maxDisconnectCostMs_)).append("ms\n");
+    result.append("  NLP disconnect window: ").append(std::to_string(CalculateWindowMs()))
+        .append("ms, bounds: [").append(std::to_string(minWindowMs_)).append(", ")
+        .append(std::to_string(maxWindowMs_)).append("]ms, recent gaps: ")
+        .append(std::to_string(recentGaps_.size())).append("\n");
+}
+}  // namespace Location
+}  // namespace OHOS
+#endif // FEATURE_NETWORK_SUPPORT
@@ -74,13 +74,13 @@ namespace Location {
             sptr<GnssStatusCallbackNapi>(new (std::nothrow) GnssStatusCallbackNapi());
         AppIdentity identity;
         identity.SetPid(data[index++]);
-        proxy->RegisterGnssStatusCallback(gnssCallbackHost, identity);
+        proxy->RegisterGnssStatusCallback(gnssCallbackHost, identity, 0);
         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIMES));
         proxy->UnregisterGnssStatusCallback(gnssCallbackHost);
         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIMES));
         auto nmeaCallbackHost =
             sptr<NmeaMessageCallbackNapi>(new (std::nothrow) NmeaMessageCallbackNapi());
-        proxy->RegisterNmeaMessageCallback(nmeaCallbackHost, identity);
+        proxy->RegisterNmeaMessageCallback(nmeaCallbackHost, identity, 0);
         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIMES));
         proxy->UnregisterNmeaMessageCallback(nmeaCallbackHost);
         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIMES));
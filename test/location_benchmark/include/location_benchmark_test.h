@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOCATION_BENCHMARK_TEST_H
+#define LOCATION_BENCHMARK_TEST_H
+
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "location.h"
+#include "request.h"
+
+namespace OHOS {
+namespace Location {
+struct BenchmarkResult {
+    std::string name;
+    int64_t param;
+    int64_t iterations;
+    int64_t nsPerOp;
+};
+
+class LocationBenchmarkTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+    static void MockNativePermission();
+    static std::unique_ptr<Location> MockLocation();
+    static std::shared_ptr<Request> MockRequest(int index);
+    static std::list<std::shared_ptr<Request>> MockRequestList(int num);
+    static void RunBenchmark(const std::string& name, int64_t param, int64_t iterations,
+        const std::function<void()>& func);
+    static std::string ResultsToJson();
+
+    static uint64_t tokenId_;
+    static std::vector<BenchmarkResult> results_;
+};
+} // namespace Location
+} // namespace OHOS
+#endif // LOCATION_BENCHMARK_TEST_H
@@ -0,0 +1,493 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "location_benchmark_test.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+
+#include "accesstoken_kit.h"
+#include "message_parcel.h"
+#include "nativetoken_kit.h"
+#include "token_setproc.h"
+
+#include "common_utils.h"
+#include "constant_definition.h"
+#include "hook_utils.h"
+#include "local_location_reporter.h"
+#include "location_log.h"
+#include "locator_callback_host.h"
+#include "permission_manager.h"
+#include "request_config.h"
+#define private public
+#include "locator_ability.h"
+#include "report_manager.h"
+#include "request_manager.h"
+#undef private
+#include "subability_common.h"
+#ifdef FEATURE_GEOCODE_SUPPORT
+#include "geo_address_cache.h"
+#endif
+#include "work_record.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Location {
+const int32_t LOCATION_PERM_NUM = 5;
+const std::string BENCHMARK_OUTPUT_ENV = "LOCATION_BENCHMARK_OUTPUT";
+const std::string BENCHMARK_OUTPUT_DEFAULT = "location_benchmark.json";
+const int64_t REPORT_ITERATION_NUM = 100;
+const int64_t HANDLE_REQUEST_ITERATION_NUM = 100;
+const int64_t PARCEL_ITERATION_NUM = 10000;
+const int64_t WORK_RECORD_ITERATION_NUM = 1000;
+const int64_t CAL_DISTANCE_ITERATION_NUM = 100000;
+const int WORK_RECORD_SIZE = 100;
+const int64_t RECORD_DIFF_ITERATION_NUM = 20;
+const double MOCK_LATITUDE = 31.2;
+const double MOCK_LONGITUDE = 121.5;
+const double MOCK_DISTANCE_OFFSET = 0.01;
+#ifdef FEATURE_GEOCODE_SUPPORT
+const int GEO_FLEET_SIZE = 50;
+const int GEO_FLEET_ROWS = 10;
+const int GEO_TRAJECTORY_STEPS = 200;
+// about 22m between two fixes of a vehicle, each route is driven there and back
+const double GEO_TRAJECTORY_STEP_DEGREE = 0.0002;
+const double GEO_CACHE_VALID_DISTANCE = 100.0;
+const int PERMILLE = 1000;
+#endif
+
+class BenchmarkSubAbility : public SubAbility {
+private:
+    void RequestRecord(WorkRecord &workRecord, bool isAdded) override {}
+    void SendReportMockLocationEvent() override {}
+};
+
+class RecordDiffSubAbility : public SubAbility {
+public:
+    void RequestRecord(WorkRecord &workRecord, bool isAdded) override
+    {
+        if (isAdded) {
+            addCallNum_++;
+            addRecordNum_ += workRecord.Size();
+        } else {
+            removeCallNum_++;
+            removeRecordNum_ += workRecord.Size();
+        }
+    }
+    void SendReportMockLocationEvent() override {}
+
+    int addCallNum_ = 0;
+    int addRecordNum_ = 0;
+    int removeCallNum_ = 0;
+    int removeRecordNum_ = 0;
+};
+
+static void FillDiffWorkRecord(WorkRecord &workRecord, int begin, int end)
+{
+    auto requestConfig = std::make_unique<RequestConfig>();
+    for (int i = begin; i < end; i++) {
+        std::shared_ptr<Request> request = std::make_shared<Request>();
+        request->SetUid(i);
+        request->SetPid(i);
+        request->SetPackageName("LocationBenchmarkTest");
+        request->SetRequestConfig(*requestConfig);
+        request->SetUuid(std::to_string(i));
+        workRecord.Add(request);
+    }
+}
+
+static void RunRecordDiffBenchmark(int recordNum)
+{
+    RecordDiffSubAbility subAbility;
+    WorkRecord firstRecord;
+    FillDiffWorkRecord(firstRecord, 0, recordNum);
+    subAbility.LocationRequest(firstRecord);
+    EXPECT_EQ(1, subAbility.addCallNum_);
+    EXPECT_EQ(recordNum, subAbility.addRecordNum_);
+
+    // half of the records stop and the same number of new records start
+    WorkRecord secondRecord;
+    FillDiffWorkRecord(secondRecord, recordNum / 2, recordNum + recordNum / 2);
+    subAbility.LocationRequest(secondRecord);
+    EXPECT_EQ(2, subAbility.addCallNum_);
+    EXPECT_EQ(recordNum + recordNum / 2, subAbility.addRecordNum_);
+    EXPECT_EQ(1, subAbility.removeCallNum_);
+    EXPECT_EQ(recordNum / 2, subAbility.removeRecordNum_);
+
+    int round = 0;
+    std::string name = "SubAbility::LocationRequest/diff";
+    LocationBenchmarkTest::RunBenchmark(name, recordNum, RECORD_DIFF_ITERATION_NUM, [&]() {
+        subAbility.LocationRequest(round++ % 2 == 0 ? firstRecord : secondRecord);
+    });
+}
+
+static int NoOpHook(const HOOK_INFO *hookInfo, void *executionContext)
+{
+    return 0;
+}
+
+uint64_t LocationBenchmarkTest::tokenId_ = 0;
+std::vector<BenchmarkResult> LocationBenchmarkTest::results_;
+
+void LocationBenchmarkTest::SetUpTestCase()
+{
+    MockNativePermission();
+    results_.clear();
+}
+
+void LocationBenchmarkTest::TearDownTestCase()
+{
+    std::string json = ResultsToJson();
+    const char* path = getenv(BENCHMARK_OUTPUT_ENV.c_str());
+    std::string outputPath = (path != nullptr && path[0] != '\0') ? path : BENCHMARK_OUTPUT_DEFAULT;
+    std::ofstream output(outputPath, std::ios::out | std::ios::trunc);
+    if (output.is_open()) {
+        output << json;
+        output.close();
+    }
+    GTEST_LOG_(INFO) << json;
+}
+
+void LocationBenchmarkTest::SetUp()
+{
+}
+
+void LocationBenchmarkTest::TearDown()
+{
+}
+
+void LocationBenchmarkTest::MockNativePermission()
+{
+    const char *perms[] = {
+        ACCESS_LOCATION.c_str(), ACCESS_APPROXIMATELY_LOCATION.c_str(),
+        ACCESS_BACKGROUND_LOCATION.c_str(), MANAGE_SECURE_SETTINGS.c_str(),
+        ACCESS_CONTROL_LOCATION_SWITCH.c_str(),
+    };
+    NativeTokenInfoParams infoInstance = {
+        .dcapsNum = 0,
+        .permsNum = LOCATION_PERM_NUM,
+        .aclsNum = 0,
+        .dcaps = nullptr,
+        .perms = perms,
+        .acls = nullptr,
+        .processName = "LocationBenchmarkTest",
+        .aplStr = "system_basic",
+    };
+    tokenId_ = GetAccessTokenId(&infoInstance);
+    SetSelfTokenID(tokenId_);
+    Security::AccessToken::AccessTokenKit::ReloadNativeTokenInfo();
+}
+
+std::unique_ptr<Location> LocationBenchmarkTest::MockLocation()
+{
+    std::unique_ptr<Location> location = std::make_unique<Location>();
+    location->SetLatitude(MOCK_LATITUDE);
+    location->SetLongitude(MOCK_LONGITUDE);
+    location->SetAccuracy(10.0); // accuracy
+    location->SetTimeStamp(CommonUtils::GetCurrentTimeMilSec());
+    location->SetTimeSinceBoot(CommonUtils::GetSinceBootTime());
+    location->SetIsFromMock(0);
+    location->SetLocationSourceType(GNSS_TYPE);
+    return location;
+}
+
+std::shared_ptr<Request> LocationBenchmarkTest::MockRequest(int index)
+{
+    std::shared_ptr<Request> request = std::make_shared<Request>();
+    std::unique_ptr<RequestConfig> requestConfig = std::make_unique<RequestConfig>();
+    requestConfig->SetScenario(SCENE_DAILY_LIFE_SERVICE);
+    requestConfig->SetFixNumber(0);
+    requestConfig->SetTimeInterval(0);
+    request->SetUid(SYSTEM_UID);
+    request->SetPid(index + 1);
+    request->SetTokenId(tokenId_);
+    request->SetFirstTokenId(0);
+    request->SetPackageName("LocationBenchmarkTest");
+    request->SetRequestConfig(*requestConfig);
+    request->SetRequesting(true);
+    request->SetUuid(std::to_string(index));
+    request->SetLocatorCallBack(sptr<ILocatorCallback>(new (std::nothrow) LocatorCallbackHost()));
+    return request;
+}
+
+std::list<std::shared_ptr<Request>> LocationBenchmarkTest::MockRequestList(int num)
+{
+    std::list<std::shared_ptr<Request>> requestList;
+    for (int i = 0; i < num; i++) {
+        requestList.push_back(MockRequest(i));
+    }
+    return requestList;
+}
+
+void LocationBenchmarkTest::RunBenchmark(const std::string& name, int64_t param, int64_t iterations,
+    const std::function<void()>& func)
+{
+    // one untimed round to warm up caches and lazily created singletons
+    func();
+    auto begin = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < iterations; i++) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    int64_t cost = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    BenchmarkResult result = {name, param, iterations, iterations > 0 ? cost / iterations : 0};
+    results_.push_back(result);
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] %{public}s(%{public}s): %{public}s ns/op", name.c_str(),
+        std::to_string(param).c_str(), std::to_string(result.nsPerOp).c_str());
+}
+
+std::string LocationBenchmarkTest::ResultsToJson()
+{
+    std::string json = "{\"suite\": \"LocationBenchmarkTest\", \"results\": [";
+    for (size_t i = 0; i < results_.size(); i++) {
+        const BenchmarkResult& result = results_[i];
+        json += (i == 0) ? "\n" : ",\n";
+        json += "  {\"name\": \"" + result.name + "\", \"param\": " + std::to_string(result.param) +
+            ", \"iterations\": " + std::to_string(result.iterations) +
+            ", \"ns_per_op\": " + std::to_string(result.nsPerOp) + "}";
+    }
+    json += "\n]}\n";
+    return json;
+}
+
+HWTEST_F(LocationBenchmarkTest, ReportManagerOnReportLocation001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationBenchmarkTest, ReportManagerOnReportLocation001, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] ReportManagerOnReportLocation001 begin");
+    auto locatorAbility = LocatorAbility::GetInstance();
+    auto reportManager = ReportManager::GetInstance();
+    auto oldGnssList = (*locatorAbility->requests_)[GNSS_ABILITY];
+    auto location = MockLocation();
+    for (int subscriberNum : {1, 10, 100}) {
+        (*locatorAbility->requests_)[GNSS_ABILITY] = MockRequestList(subscriberNum);
+        RunBenchmark("ReportManager::OnReportLocation", subscriberNum, REPORT_ITERATION_NUM, [&]() {
+            location->SetTimeSinceBoot(CommonUtils::GetSinceBootTime());
+            reportManager->OnReportLocation(location, GNSS_ABILITY);
+        });
+    }
+    (*locatorAbility->requests_)[GNSS_ABILITY] = oldGnssList;
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] ReportManagerOnReportLocation001 end");
+}
+
+HWTEST_F(LocationBenchmarkTest, ReportManagerOnReportLocationHook001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationBenchmarkTest, ReportManagerOnReportLocationHook001, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] ReportManagerOnReportLocationHook001 begin");
+    const int subscriberNum = 100;
+    auto locatorAbility = LocatorAbility::GetInstance();
+    auto reportManager = ReportManager::GetInstance();
+    auto oldGnssList = (*locatorAbility->requests_)[GNSS_ABILITY];
+    (*locatorAbility->requests_)[GNSS_ABILITY] = MockRequestList(subscriberNum);
+    auto location = MockLocation();
+    auto report = [&]() {
+        location->SetTimeSinceBoot(CommonUtils::GetSinceBootTime());
+        reportManager->OnReportLocation(location, GNSS_ABILITY);
+    };
+    // without any hook the request and location are not copied into the hook payloads
+    bool hasHook = HookUtils::HasHook(LocationProcessStage::LOCATION_REPORT_PROCESS) ||
+        HookUtils::HasHook(LocationProcessStage::LOCATOR_SA_LOCATION_REPORT_PROCESS);
+    if (!hasHook) {
+        RunBenchmark("ReportManager::OnReportLocation/no_hook", subscriberNum, REPORT_ITERATION_NUM, report);
+    }
+    EXPECT_EQ(ERRCODE_SUCCESS, HookUtils::RegisterHook(LocationProcessStage::LOCATION_REPORT_PROCESS, 0, NoOpHook));
+    EXPECT_EQ(ERRCODE_SUCCESS,
+        HookUtils::RegisterHook(LocationProcessStage::LOCATOR_SA_LOCATION_REPORT_PROCESS, 0, NoOpHook));
+    EXPECT_EQ(true, HookUtils::HasHook(LocationProcessStage::LOCATION_REPORT_PROCESS));
+    RunBenchmark("ReportManager::OnReportLocation/noop_hook", subscriberNum, REPORT_ITERATION_NUM, report);
+    HookUtils::UnregisterHook(LocationProcessStage::LOCATION_REPORT_PROCESS, NoOpHook);
+    HookUtils::UnregisterHook(LocationProcessStage::LOCATOR_SA_LOCATION_REPORT_PROCESS, NoOpHook);
+    EXPECT_EQ(hasHook, HookUtils::HasHook(LocationProcessStage::LOCATION_REPORT_PROCESS) ||
+        HookUtils::HasHook(LocationProcessStage::LOCATOR_SA_LOCATION_REPORT_PROCESS));
+    (*locatorAbility->requests_)[GNSS_ABILITY] = oldGnssList;
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] ReportManagerOnReportLocationHook001 end");
+}
+
+HWTEST_F(LocationBenchmarkTest, RequestManagerHandleRequest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationBenchmarkTest, RequestManagerHandleRequest001, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] RequestManagerHandleRequest001 begin");
+    auto requestManager = RequestManager::GetInstance();
+    for (int requestNum : {10, 100, 500}) {
+        auto requestList = MockRequestList(requestNum);
+        int index = requestNum;
+        // one request stops and another one starts on every round
+        RunBenchmark("RequestManager::HandleRequest", requestNum, HANDLE_REQUEST_ITERATION_NUM, [&]() {
+            requestList.pop_front();
+            requestList.push_back(MockRequest(index++));
+            requestManager->HandleRequest(GNSS_ABILITY, requestList);
+        });
+    }
+    std::list<std::shared_ptr<Request>> emptyList;
+    requestManager->HandleRequest(GNSS_ABILITY, emptyList);
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] RequestManagerHandleRequest001 end");
+}
+
+HWTEST_F(LocationBenchmarkTest, LocationParcel001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationBenchmarkTest, LocationParcel001, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] LocationParcel001 begin");
+    auto location = MockLocation();
+    RunBenchmark("Location::Marshalling", 1, PARCEL_ITERATION_NUM, [&]() {
+        MessageParcel parcel;
+        location->Marshalling(parcel);
+    });
+    MessageParcel parcel;
+    EXPECT_EQ(true, location->Marshalling(parcel));
+    RunBenchmark("Location::Unmarshalling", 1, PARCEL_ITERATION_NUM, [&]() {
+        parcel.RewindRead(0);
+        auto newLocation = Location::UnmarshallingMakeUnique(parcel);
+    });
+    parcel.RewindRead(0);
+    auto newLocation = Location::UnmarshallingMakeUnique(parcel);
+    ASSERT_NE(nullptr, newLocation);
+    EXPECT_EQ(MOCK_LATITUDE, newLocation->GetLatitude());
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] LocationParcel001 end");
+}
+
+HWTEST_F(LocationBenchmarkTest, SubAbilityReportLocation001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationBenchmarkTest, SubAbilityReportLocation001, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] SubAbilityReportLocation001 begin");
+    auto locatorAbility = LocatorAbility::GetInstance();
+    std::shared_ptr<Location> location = MockLocation();
+    // split process: what the locator stub does for every fix, the binder transaction itself is not included
+    LocalLocationReporter::GetInstance()->UnregisterReporter();
+    RunBenchmark("SubAbility::ReportLocationInfo/parcel", 1, REPORT_ITERATION_NUM, [&]() {
+        MessageParcel parcel;
+        location->Marshalling(parcel);
+        auto newLocation = Location::UnmarshallingMakeUnique(parcel);
+        locatorAbility->ReportLocation(GNSS_ABILITY, *newLocation);
+    });
+    // same process: the location object is handed to the locator directly
+    locatorAbility->RegisterLocalLocationReporter();
+    EXPECT_EQ(true, LocalLocationReporter::GetInstance()->IsRegistered());
+    BenchmarkSubAbility subAbility;
+    RunBenchmark("SubAbility::ReportLocationInfo/in_process", 1, REPORT_ITERATION_NUM, [&]() {
+        subAbility.ReportLocationInfo(GNSS_ABILITY, location);
+    });
+    EXPECT_EQ(true, LocalLocationReporter::GetInstance()->ReportLocation(GNSS_ABILITY, location));
+    LocalLocationReporter::GetInstance()->UnregisterReporter();
+    EXPECT_EQ(false, LocalLocationReporter::GetInstance()->ReportLocation(GNSS_ABILITY, location));
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] SubAbilityReportLocation001 end");
+}
+
+HWTEST_F(LocationBenchmarkTest, SubAbilityRecordDiff001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationBenchmarkTest, SubAbilityRecordDiff001, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] SubAbilityRecordDiff001 begin");
+    RunRecordDiffBenchmark(10);
+    RunRecordDiffBenchmark(100);
+    RunRecordDiffBenchmark(1000);
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] SubAbilityRecordDiff001 end");
+}
+
+HWTEST_F(LocationBenchmarkTest, WorkRecord001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationBenchmarkTest, WorkRecord001, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] WorkRecord001 begin");
+    auto requestList = MockRequestList(WORK_RECORD_SIZE);
+    RunBenchmark("WorkRecord::Add", WORK_RECORD_SIZE, WORK_RECORD_ITERATION_NUM, [&]() {
+        WorkRecord workRecord;
+        for (auto& request : requestList) {
+            workRecord.Add(request);
+        }
+    });
+    WorkRecord workRecord;
+    for (auto& request : requestList) {
+        workRecord.Add(request);
+    }
+    auto lastRequest = requestList.back();
+    RunBenchmark("WorkRecord::Find", WORK_RECORD_SIZE, WORK_RECORD_ITERATION_NUM, [&]() {
+        workRecord.Find(lastRequest->GetUid(), lastRequest->GetPackageName(), lastRequest->GetUuid());
+    });
+    RunBenchmark("WorkRecord::Set", WORK_RECORD_SIZE, WORK_RECORD_ITERATION_NUM, [&]() {
+        WorkRecord newRecord;
+        newRecord.Set(workRecord);
+    });
+    RunBenchmark("WorkRecord::Marshalling", WORK_RECORD_SIZE, WORK_RECORD_ITERATION_NUM, [&]() {
+        MessageParcel parcel;
+        workRecord.Marshalling(parcel);
+    });
+    EXPECT_EQ(true, workRecord.Find(lastRequest->GetUid(), lastRequest->GetPackageName(), lastRequest->GetUuid()));
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] WorkRecord001 end");
+}
+
+HWTEST_F(LocationBenchmarkTest, CommonUtilsCalDistance001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationBenchmarkTest, CommonUtilsCalDistance001, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] CommonUtilsCalDistance001 begin");
+    double distance = 0.0;
+    RunBenchmark("CommonUtils::CalDistance", 1, CAL_DISTANCE_ITERATION_NUM, [&]() {
+        distance = CommonUtils::CalDistance(MOCK_LATITUDE, MOCK_LONGITUDE,
+            MOCK_LATITUDE + MOCK_DISTANCE_OFFSET, MOCK_LONGITUDE + MOCK_DISTANCE_OFFSET);
+    });
+    EXPECT_GT(distance, 0.0);
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] CommonUtilsCalDistance001 end");
+}
+
+#ifdef FEATURE_GEOCODE_SUPPORT
+HWTEST_F(LocationBenchmarkTest, GeoAddressCache001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationBenchmarkTest, GeoAddressCache001, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] GeoAddressCache001 begin");
+    std::vector<std::pair<double, double>> trajectory;
+    for (int step = 0; step < GEO_TRAJECTORY_STEPS; step++) {
+        int position = step < GEO_TRAJECTORY_STEPS / 2 ? step : GEO_TRAJECTORY_STEPS - 1 - step;
+        for (int vehicle = 0; vehicle < GEO_FLEET_SIZE; vehicle++) {
+            trajectory.push_back(std::make_pair(MOCK_LATITUDE + (vehicle % GEO_FLEET_ROWS) * MOCK_DISTANCE_OFFSET,
+                MOCK_LONGITUDE + (vehicle / GEO_FLEET_ROWS) * MOCK_DISTANCE_OFFSET +
+                position * GEO_TRAJECTORY_STEP_DEGREE));
+        }
+    }
+    std::list<std::shared_ptr<GeoAddress>> addresses;
+    auto geoAddress = std::make_shared<GeoAddress>();
+    geoAddress->placeName_ = "LocationBenchmarkTest";
+    addresses.push_back(geoAddress);
+    std::vector<int64_t> hitRates;
+    for (size_t capacity : {10, 100, 2000}) {
+        GeoAddressCache cache(capacity, GEO_CACHE_VALID_DISTANCE);
+        int64_t index = 0;
+        int64_t hitCount = 0;
+        // reverse geocode every fix, a miss is answered by the backend and cached
+        RunBenchmark("GeoAddressCache::Get", capacity, trajectory.size(), [&]() {
+            const auto& point = trajectory[index % trajectory.size()];
+            index++;
+            if (cache.Get("zh", point.first, point.second, 1).empty()) {
+                cache.Put("zh", point.first, point.second, addresses);
+            } else {
+                hitCount++;
+            }
+        });
+        hitRates.push_back(hitCount * PERMILLE / index);
+        LBSLOGI(LOCATOR, "[LocationBenchmarkTest] GeoAddressCache(%{public}s) hit rate: %{public}s permille",
+            std::to_string(capacity).c_str(), std::to_string(hitRates.back()).c_str());
+    }
+    EXPECT_GT(hitRates.back(), hitRates.front());
+    LBSLOGI(LOCATOR, "[LocationBenchmarkTest] GeoAddressCache001 end");
+}
+#endif
+} // namespace Location
+} // namespace OHOS
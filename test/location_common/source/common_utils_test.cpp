@@ -24,6 +24,7 @@
 #include "system_ability_definition.h"
 #include "token_setproc.h"
 
+#include "active_account_cache.h"
 #include "common_utils.h"
 #include "bundle_mgr_helper.h"
 #include "location_log.h"
@@ -344,5 +345,37 @@ HWTEST_F(CommonUtilsTest, GenerateUuid001, TestSize.Level1)
     EXPECT_LT(0, uuid.size());
     LBSLOGI(COMMON_UTILS, "[CommonUtilsTest] GenerateUuid001 end");
 }
+
+HWTEST_F(CommonUtilsTest, ActiveAccountCache001, TestSize.Level1)
+{
+    LBSLOGI(COMMON_UTILS, "[CommonUtilsTest] ActiveAccountCache001 begin");
+    auto accountCache = ActiveAccountCache::GetInstance();
+    std::vector<int> activeIds;
+    accountCache->SetEventDriven(false);
+    EXPECT_EQ(false, accountCache->GetActiveUserIds(activeIds)); // not event driven, always query
+
+    accountCache->SetEventDriven(true);
+    EXPECT_EQ(false, accountCache->GetActiveUserIds(activeIds)); // empty cache
+    uint64_t queried = accountCache->GetQueriedIpcCount();
+    CommonUtils::GetActiveUserIds(activeIds);
+    EXPECT_EQ(queried + 1, accountCache->GetQueriedIpcCount());
+    uint64_t avoided = accountCache->GetAvoidedIpcCount();
+    std::vector<int> cachedIds;
+    EXPECT_EQ(true, CommonUtils::GetActiveUserIds(cachedIds));
+    EXPECT_EQ(activeIds, cachedIds);
+    EXPECT_EQ(avoided + 1, accountCache->GetAvoidedIpcCount());
+    EXPECT_EQ(queried + 1, accountCache->GetQueriedIpcCount());
+
+    // result of a query that raced with an account event is dropped
+    uint64_t generation = accountCache->GetGeneration();
+    accountCache->Invalidate();
+    accountCache->UpdateActiveUserIds({100}, generation); // 100 is user id
+    EXPECT_EQ(false, accountCache->GetActiveUserIds(cachedIds));
+    accountCache->UpdateActiveUserIds({100, 101}, accountCache->GetGeneration()); // 100, 101 are user ids
+    EXPECT_EQ(true, accountCache->GetActiveUserIds(cachedIds));
+    EXPECT_EQ(2, cachedIds.size());
+    accountCache->SetEventDriven(false);
+    LBSLOGI(COMMON_UTILS, "[CommonUtilsTest] ActiveAccountCache001 end");
+}
 } // namespace Location
 } // namespace OHOS
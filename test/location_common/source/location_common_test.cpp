@@ -15,6 +15,8 @@
 
 #include "location_common_test.h"
 
+#include <chrono>
+
 #include "string_ex.h"
 
 #define private public
@@ -324,6 +326,147 @@ HWTEST_F(LocationCommonTest, SateLLiteStatusTest001, TestSize.Level1)
 }
 #endif
 
+/*
+ * @tc.name: SateLLiteStatusTest002
+ * @tc.desc: build, copy and marshall a 64 satellites status.
+ * @tc.type: FUNC
+ */
+#ifdef FEATURE_GNSS_SUPPORT
+HWTEST_F(LocationCommonTest, SateLLiteStatusTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationCommonTest, SateLLiteStatusTest002, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationCommonTest] SateLLiteStatusTest002 begin");
+    const int sateNum = 64;
+    const int roundNum = 1000;
+    int64_t buildCost = 0;
+    int64_t copyCost = 0;
+    int64_t marshallingCost = 0;
+    for (int round = 0; round < roundNum; round++) {
+        auto begin = std::chrono::steady_clock::now();
+        std::unique_ptr<SatelliteStatus> status = std::make_unique<SatelliteStatus>();
+        status->SetSatellitesNumber(sateNum);
+        status->ReserveSatellites(sateNum);
+        for (int i = 0; i < sateNum; i++) {
+            SatelliteInfo satellite;
+            satellite.satelliteId = i;
+            satellite.carrierToNoiseDensity = i + 1.0;
+            satellite.altitude = i + 2.0;
+            satellite.azimuth = i + 3.0;
+            satellite.carrierFrequency = i + 4.0;
+            satellite.constellationType = i + 5;
+            satellite.additionalInfo = i + 6;
+            status->AddSatellite(satellite);
+        }
+        auto built = std::chrono::steady_clock::now();
+        std::unique_ptr<SatelliteStatus> copyStatus = std::make_unique<SatelliteStatus>(*status);
+        auto copied = std::chrono::steady_clock::now();
+        MessageParcel parcel;
+        EXPECT_EQ(true, copyStatus->Marshalling(parcel));
+        auto marshalled = std::chrono::steady_clock::now();
+        buildCost += std::chrono::duration_cast<std::chrono::nanoseconds>(built - begin).count();
+        copyCost += std::chrono::duration_cast<std::chrono::nanoseconds>(copied - built).count();
+        marshallingCost += std::chrono::duration_cast<std::chrono::nanoseconds>(marshalled - copied).count();
+        if (round != 0) {
+            continue;
+        }
+        // the wire format is the same as the one written attribute by attribute
+        std::unique_ptr<SatelliteStatus> newStatus = SatelliteStatus::Unmarshalling(parcel);
+        EXPECT_EQ(sateNum, newStatus->GetSatellitesNumber());
+        EXPECT_EQ(static_cast<size_t>(sateNum), newStatus->GetSatellites().size());
+        EXPECT_EQ(sateNum - 1, newStatus->GetSatelliteIds()[sateNum - 1]);
+        EXPECT_EQ(sateNum + 3.0, newStatus->GetAzimuths()[sateNum - 1]);
+        EXPECT_EQ(sateNum + 5, newStatus->GetSatelliteAdditionalInfoList()[sateNum - 1]);
+    }
+    GTEST_LOG_(INFO) << "64 satellites, build: " << buildCost / roundNum << " ns, copy: " <<
+        copyCost / roundNum << " ns, marshalling: " << marshallingCost / roundNum << " ns";
+
+    // attributes set one by one still have to be complete to be marshalled
+    SatelliteStatus partialStatus;
+    partialStatus.SetSatellitesNumber(1);
+    partialStatus.SetSatelliteId(1);
+    MessageParcel partialParcel;
+    EXPECT_EQ(false, partialStatus.Marshalling(partialParcel));
+    // a whole satellite appended to a partial status does not fill the attributes that were never set
+    SatelliteInfo satellite;
+    satellite.satelliteId = 2;
+    satellite.azimuth = 3.0;
+    partialStatus.SetSatellitesNumber(2);
+    partialStatus.AddSatellite(satellite);
+    EXPECT_EQ(static_cast<size_t>(2), partialStatus.GetSatelliteIds().size());
+    EXPECT_EQ(2, partialStatus.GetSatelliteIds()[1]);
+    EXPECT_EQ(static_cast<size_t>(1), partialStatus.GetAzimuths().size());
+    EXPECT_EQ(3.0, partialStatus.GetAzimuths()[0]);
+    EXPECT_EQ(false, partialStatus.Marshalling(partialParcel));
+    LBSLOGI(LOCATOR, "[LocationCommonTest] SateLLiteStatusTest002 end");
+}
+#endif
+
+/*
+ * @tc.name: SateLLiteStatusTest003
+ * @tc.desc: count the used gps satellites of 64 and 128 satellites status by index.
+ * @tc.type: FUNC
+ */
+#ifdef FEATURE_GNSS_SUPPORT
+HWTEST_F(LocationCommonTest, SateLLiteStatusTest003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationCommonTest, SateLLiteStatusTest003, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationCommonTest] SateLLiteStatusTest003 begin");
+    const int roundNum = 1000;
+    const int gpsConstellation = SatelliteConstellation::SV_CONSTELLATION_CATEGORY_GPS;
+    const int usedInFix = SatelliteAdditionalInfo::SV_ADDITIONAL_INFO_USED_IN_FIX;
+    for (int sateNum : {64, 128}) {
+        std::unique_ptr<SatelliteStatus> status = std::make_unique<SatelliteStatus>();
+        status->SetSatellitesNumber(sateNum);
+        status->ReserveSatellites(sateNum);
+        for (int i = 0; i < sateNum; i++) {
+            SatelliteInfo satellite;
+            satellite.satelliteId = i;
+            // every other satellite is gps, every other gps satellite is used in fix
+            satellite.constellationType = i % 2 == 0 ? gpsConstellation : gpsConstellation + 1;
+            satellite.additionalInfo = i % 4 == 0 ? usedInFix : 0;
+            status->AddSatellite(satellite);
+        }
+        int64_t listCost = 0;
+        int64_t indexCost = 0;
+        for (int round = 0; round < roundNum; round++) {
+            int listUsedCount = 0;
+            auto begin = std::chrono::steady_clock::now();
+            for (int i = 0; i < sateNum; i++) {
+                if (status->GetConstellationTypes()[i] == gpsConstellation &&
+                    (status->GetSatelliteAdditionalInfoList()[i] & usedInFix)) {
+                    listUsedCount++;
+                }
+            }
+            auto listed = std::chrono::steady_clock::now();
+            int indexUsedCount = 0;
+            for (int i = 0; i < sateNum; i++) {
+                if (status->GetConstellationType(i) == gpsConstellation &&
+                    (status->GetSatelliteAdditionalInfo(i) & usedInFix)) {
+                    indexUsedCount++;
+                }
+            }
+            auto indexed = std::chrono::steady_clock::now();
+            listCost += std::chrono::duration_cast<std::chrono::nanoseconds>(listed - begin).count();
+            indexCost += std::chrono::duration_cast<std::chrono::nanoseconds>(indexed - listed).count();
+            EXPECT_EQ(sateNum / 4, indexUsedCount);
+            EXPECT_EQ(listUsedCount, indexUsedCount);
+        }
+        GTEST_LOG_(INFO) << sateNum << " satellites, list access: " << listCost / roundNum <<
+            " ns, index access: " << indexCost / roundNum << " ns";
+    }
+
+    // an attribute not set yet or out of range reads as default
+    SatelliteStatus partialStatus;
+    partialStatus.SetSatellitesNumber(1);
+    partialStatus.SetSatelliteId(1);
+    EXPECT_EQ(0, partialStatus.GetConstellationType(0));
+    EXPECT_EQ(0, partialStatus.GetSatelliteAdditionalInfo(1));
+    LBSLOGI(LOCATOR, "[LocationCommonTest] SateLLiteStatusTest003 end");
+}
+#endif
+
 /*
  * @tc.name: RequestConfigTest001
  * @tc.desc: read from parcel.
@@ -813,6 +956,22 @@ HWTEST_F(LocationCommonTest, HookUtils002, TestSize.Level1)
     LBSLOGI(LOCATOR, "[LocationCommonTest] HookUtils002 end");
 }
 
+HWTEST_F(LocationCommonTest, HookUtils003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "LocationCommonTest, HookUtils003, TestSize.Level1";
+    LBSLOGI(LOCATOR, "[LocationCommonTest] HookUtils003 begin");
+    ASSERT_TRUE(HookUtils::GetLocationExtHookMgr() != nullptr);
+    EXPECT_EQ(false, HookUtils::HasHook(LocationProcessStage::REQUEST_MANAGER_HANDLE_STOP));
+    EXPECT_EQ(ERRCODE_SUCCESS,
+        HookUtils::RegisterHook(LocationProcessStage::REQUEST_MANAGER_HANDLE_STOP, 0, OhosHookTest01));
+    EXPECT_EQ(true, HookUtils::HasHook(LocationProcessStage::REQUEST_MANAGER_HANDLE_STOP));
+    EXPECT_EQ(false, HookUtils::HasHook(LocationProcessStage::FUSION_REPORT_PROCESS));
+    HookUtils::UnregisterHook(LocationProcessStage::REQUEST_MANAGER_HANDLE_STOP, OhosHookTest01);
+    EXPECT_EQ(false, HookUtils::HasHook(LocationProcessStage::REQUEST_MANAGER_HANDLE_STOP));
+    LBSLOGI(LOCATOR, "[LocationCommonTest] HookUtils003 end");
+}
+
 HWTEST_F(LocationCommonTest, Request001, TestSize.Level1)
 {
     GTEST_LOG_(INFO)
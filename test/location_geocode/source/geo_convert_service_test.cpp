@@ -67,6 +67,10 @@ namespace Location {
 const int32_t LOCATION_PERM_NUM = 5;
 const int32_t LOOP_COUNT = 11;
 const std::string ARGS_HELP = "-h";
+const std::string COALESCING_LOCALE = "coalescing_test";
+const double COALESCING_LATITUDE = 31.2305;
+const double COALESCING_LONGITUDE = 121.4737;
+const int COALESCING_MAX_ITEMS = 5;
 void GeoConvertServiceTest::SetUp()
 {
     /*
@@ -761,6 +765,209 @@ HWTEST_F(GeoConvertServiceTest, SendCacheAddressToRequest001, TestSize.Level1)
     service_->SendCacheAddressToRequest(std::make_unique<GeoConvertRequest>(*geoConvertRequest), result);
     LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] OrderParcel001 end");
 }
+
+HWTEST_F(GeoConvertServiceTest, GetCahedGeoAddress002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GeoConvertServiceTest, GetCahedGeoAddress002, TestSize.Level1";
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] GetCahedGeoAddress002 begin");
+    auto geoConvertRequest = std::make_unique<GeoConvertRequest>();
+    geoConvertRequest->SetLocale("cache_test");
+    geoConvertRequest->SetLatitude(31.2305);
+    geoConvertRequest->SetLongitude(121.4737);
+    geoConvertRequest->SetMaxItems(1);
+    std::list<std::shared_ptr<GeoAddress>> result;
+    std::shared_ptr<GeoAddress> geoAddress = std::make_shared<GeoAddress>();
+    geoAddress->placeName_ = "Shanghai";
+    result.push_back(geoAddress);
+    MessageParcel dataParcel;
+    service_->WriteResultToParcel(result, dataParcel);
+    service_->AddCahedGeoAddress(*geoConvertRequest, dataParcel);
+
+    // about 66m away and in the neighbouring grid cell
+    geoConvertRequest->SetLatitude(31.2299);
+    auto cachedResult = service_->GetCahedGeoAddress(std::make_unique<GeoConvertRequest>(*geoConvertRequest));
+    ASSERT_EQ(1, cachedResult.size());
+    EXPECT_EQ("Shanghai", cachedResult.front()->placeName_);
+    // about 550m away
+    geoConvertRequest->SetLatitude(31.2355);
+    EXPECT_EQ(0, service_->GetCahedGeoAddress(std::make_unique<GeoConvertRequest>(*geoConvertRequest)).size());
+    geoConvertRequest->SetLatitude(31.2305);
+    geoConvertRequest->SetLocale("cache_test_other");
+    EXPECT_EQ(0, service_->GetCahedGeoAddress(std::make_unique<GeoConvertRequest>(*geoConvertRequest)).size());
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] GetCahedGeoAddress002 end");
+}
+
+HWTEST_F(GeoConvertServiceTest, GeoAddressCacheEviction001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GeoConvertServiceTest, GeoAddressCacheEviction001, TestSize.Level1";
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] GeoAddressCacheEviction001 begin");
+    GeoAddressCache cache(3, 100);
+    std::list<std::shared_ptr<GeoAddress>> addresses;
+    addresses.push_back(std::make_shared<GeoAddress>());
+    // positions A to E, one degree of latitude apart
+    std::vector<double> latitudes = {10, 11, 12, 13, 14};
+    auto isCached = [&cache, &latitudes](int index) {
+        return cache.Get("zh", latitudes[index], 10, 1).size() > 0;
+    };
+    cache.Put("zh", latitudes[0], 10, addresses);
+    cache.Put("zh", latitudes[1], 10, addresses);
+    cache.Put("zh", latitudes[2], 10, addresses);
+    EXPECT_EQ(true, isCached(0));
+    // B is the least recently used
+    cache.Put("zh", latitudes[3], 10, addresses);
+    EXPECT_EQ(false, isCached(1));
+    EXPECT_EQ(true, isCached(2));
+    // A is the least recently used now, C and D were used after it
+    cache.Put("zh", latitudes[4], 10, addresses);
+    EXPECT_EQ(false, isCached(0));
+    EXPECT_EQ(true, isCached(3));
+    EXPECT_EQ(true, isCached(4));
+    EXPECT_EQ(true, isCached(2));
+    EXPECT_EQ(3, cache.Size());
+    std::string result;
+    cache.DumpInfo(result);
+    EXPECT_EQ("GeoAddress cache size: 3, capacity: 3, hit: 5, miss: 2, eviction: 2\n", result);
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] GeoAddressCacheEviction001 end");
+}
+
+HWTEST_F(GeoConvertServiceTest, GeoAddressCachePole001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GeoConvertServiceTest, GeoAddressCachePole001, TestSize.Level1";
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] GeoAddressCachePole001 begin");
+    GeoAddressCache cache(3, 100);
+    std::list<std::shared_ptr<GeoAddress>> addresses;
+    addresses.push_back(std::make_shared<GeoAddress>());
+    // near the pole the valid distance spans the whole row, the cached cells of the row are walked instead
+    cache.Put("zh", 89.95, 179.99, addresses);
+    EXPECT_EQ(1, cache.Get("zh", 89.95, 179.99, 1).size());
+    // a few meters away across the antimeridian
+    EXPECT_EQ(1, cache.Get("zh", 89.95, -179.99, 1).size());
+    // the other side of the pole is about 11km away
+    EXPECT_EQ(0, cache.Get("zh", 89.95, 0, 1).size());
+    EXPECT_EQ(0, cache.Get("en", 89.95, 179.99, 1).size());
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] GeoAddressCachePole001 end");
+}
+
+HWTEST_F(GeoConvertServiceTest, ReverseGeocodeCoalescing001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GeoConvertServiceTest, ReverseGeocodeCoalescing001, TestSize.Level1";
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] ReverseGeocodeCoalescing001 begin");
+    auto geoConvertService = GeoConvertService::GetInstance();
+    auto mockLocation = std::make_shared<ReverseGeocodeRequest>();
+    mockLocation->locale = COALESCING_LOCALE;
+    mockLocation->latitude = COALESCING_LATITUDE;
+    mockLocation->longitude = COALESCING_LONGITUDE;
+    mockLocation->maxItems = COALESCING_MAX_ITEMS;
+    auto mockAddress = std::make_shared<GeoAddress>();
+    mockAddress->placeName_ = "Shanghai";
+    auto info = std::make_shared<GeocodingMockInfo>();
+    info->SetLocation(mockLocation);
+    info->SetGeoAddressInfo(mockAddress);
+    std::vector<std::shared_ptr<GeocodingMockInfo>> mockInfo = {info};
+    EXPECT_EQ(ERRCODE_SUCCESS, geoConvertService->SetReverseGeocodingMockInfo(mockInfo));
+    // the backend only counts the requests, its answer is built from the reverse geocoding mock below
+    int backendCallCount = 0;
+    auto backend = sptr<MockIRemoteObject>(new (std::nothrow) MockIRemoteObject());
+    EXPECT_CALL(*backend, SendRequest(_, _, _, _)).WillRepeatedly(InvokeWithoutArgs([&backendCallCount]() {
+        backendCallCount++;
+        return ERR_OK;
+    }));
+    geoConvertService->serviceProxy_ = backend;
+    geoConvertService->SetServiceConnectState(ServiceConnectState::STATE_CONNECTTED);
+    auto handler = std::make_shared<GeoConvertHandler>(AppExecFwk::EventRunner::Create(true));
+    auto sendRequest = [&handler](double latitude, int maxItems, const sptr<IRemoteObject>& callback) {
+        auto request = std::make_unique<GeoConvertRequest>();
+        request->SetRequestType(GeoCodeType::REQUEST_REVERSE_GEOCODE);
+        request->SetLocale(COALESCING_LOCALE);
+        request->SetLatitude(latitude);
+        request->SetLongitude(COALESCING_LONGITUDE);
+        request->SetMaxItems(maxItems);
+        request->SetCallback(callback);
+        AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(0x0100, request);
+        handler->SendGeocodeRequest(event);
+    };
+    std::vector<sptr<MockIRemoteObject>> callbacks;
+    for (int i = 0; i < 5; i++) {
+        callbacks.push_back(sptr<MockIRemoteObject>(new (std::nothrow) MockIRemoteObject()));
+    }
+    sendRequest(COALESCING_LATITUDE, COALESCING_MAX_ITEMS, callbacks[0]);
+    sendRequest(COALESCING_LATITUDE, COALESCING_MAX_ITEMS, callbacks[1]);
+    // about 33m away and fewer items, still answered by the first request
+    sendRequest(COALESCING_LATITUDE + 0.0003, 1, callbacks[2]);
+    // more items than the first request asked for
+    sendRequest(COALESCING_LATITUDE, COALESCING_MAX_ITEMS + 1, callbacks[3]);
+    EXPECT_EQ(2, backendCallCount);
+    ASSERT_EQ(2, geoConvertService->inFlightReverseGeocodes_.size());
+    auto inFlight = geoConvertService->inFlightReverseGeocodes_.begin();
+    EXPECT_EQ(2, inFlight->second.waiters.size());
+
+    EXPECT_CALL(*callbacks[0], SendRequest(_, _, _, _)).Times(1).WillOnce(Return(ERR_OK));
+    EXPECT_CALL(*callbacks[1], SendRequest(_, _, _, _)).Times(1).WillOnce(Return(ERR_OK));
+    EXPECT_CALL(*callbacks[2], SendRequest(_, _, _, _)).Times(1).WillOnce(Return(ERR_OK));
+    EXPECT_CALL(*callbacks[3], SendRequest(_, _, _, _)).Times(0);
+    sptr<GeoCodeCallback> geoCodeCallback = new (std::nothrow) GeoCodeCallback();
+    geoCodeCallback->request_ = *inFlight->second.request;
+    geoCodeCallback->flightId_ = inFlight->first;
+    MessageParcel mockRequest;
+    mockRequest.WriteString16(Str8ToStr16(COALESCING_LOCALE));
+    mockRequest.WriteDouble(COALESCING_LATITUDE);
+    mockRequest.WriteDouble(COALESCING_LONGITUDE);
+    mockRequest.WriteInt32(COALESCING_MAX_ITEMS);
+    MessageParcel data;
+    data.WriteInterfaceToken(GeoCodeCallback::GetDescriptor());
+    geoConvertService->ReportAddressMock(mockRequest, data);
+    MessageParcel reply;
+    MessageOption option;
+    geoCodeCallback->OnRemoteRequest(GeoCodeCallback::RECEIVE_GEOCODE_INFO_EVENT, data, reply, option);
+    EXPECT_EQ(1, geoConvertService->inFlightReverseGeocodes_.size());
+
+    // the shared answer is cached as well
+    EXPECT_CALL(*callbacks[4], SendRequest(_, _, _, _)).Times(1).WillOnce(Return(ERR_OK));
+    sendRequest(COALESCING_LATITUDE, 1, callbacks[4]);
+    EXPECT_EQ(2, backendCallCount);
+    for (auto& callback : callbacks) {
+        Mock::VerifyAndClearExpectations(callback.GetRefPtr());
+    }
+    geoConvertService->inFlightReverseGeocodes_.clear();
+    geoConvertService->serviceProxy_ = nullptr;
+    geoConvertService->SetServiceConnectState(ServiceConnectState::STATE_DISCONNECT);
+    mockInfo.clear();
+    geoConvertService->SetReverseGeocodingMockInfo(mockInfo);
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] ReverseGeocodeCoalescing001 end");
+}
+
+HWTEST_F(GeoConvertServiceTest, ReverseGeocodeCoalescing002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GeoConvertServiceTest, ReverseGeocodeCoalescing002, TestSize.Level1";
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] ReverseGeocodeCoalescing002 begin");
+    auto geoConvertService = GeoConvertService::GetInstance();
+    GeoConvertRequest request;
+    request.SetRequestType(GeoCodeType::REQUEST_REVERSE_GEOCODE);
+    request.SetLocale(COALESCING_LOCALE);
+    request.SetLatitude(COALESCING_LATITUDE);
+    request.SetLongitude(COALESCING_LONGITUDE);
+    request.SetMaxItems(COALESCING_MAX_ITEMS);
+    geoConvertService->AddInFlightReverseGeocode(request);
+    auto waiterCallback = sptr<MockIRemoteObject>(new (std::nothrow) MockIRemoteObject());
+    request.SetCallback(waiterCallback);
+    EXPECT_EQ(true, geoConvertService->JoinInFlightReverseGeocode(request));
+
+    // the backend dies before answering, the waiter gets an error instead of waiting forever
+    EXPECT_CALL(*waiterCallback, SendRequest(GeoCodeCallback::ERROR_INFO_EVENT, _, _, _))
+        .Times(1).WillOnce(Return(ERR_OK));
+    sptr<GeoServiceDeathRecipient> recipient = new (std::nothrow) GeoServiceDeathRecipient();
+    wptr<IRemoteObject> remote;
+    recipient->OnRemoteDied(remote);
+    EXPECT_EQ(0, geoConvertService->inFlightReverseGeocodes_.size());
+    EXPECT_EQ(false, geoConvertService->JoinInFlightReverseGeocode(request));
+    Mock::VerifyAndClearExpectations(waiterCallback.GetRefPtr());
+    LBSLOGI(GEO_CONVERT, "[GeoConvertServiceTest] ReverseGeocodeCoalescing002 end");
+}
 }  // namespace Location
 } // namespace OHOS
 #endif // FEATURE_GEOCODE_SUPPORT
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GNSS_INNER_EVENT_AGGREGATOR_TEST_H
+#define GNSS_INNER_EVENT_AGGREGATOR_TEST_H
+#ifdef FEATURE_GNSS_SUPPORT
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gnss_inner_event_aggregator.h"
+
+namespace OHOS {
+namespace Location {
+struct CapturedInnerEvent {
+    int event;
+    std::map<std::string, std::string> params;
+};
+
+class CapturingInnerEventAggregator : public GnssInnerEventAggregator {
+public:
+    CapturingInnerEventAggregator(int64_t windowMs, int rawEventSampleRate)
+        : GnssInnerEventAggregator(windowMs, rawEventSampleRate) {}
+    std::vector<CapturedInnerEvent> GetEvents(int event);
+    std::vector<CapturedInnerEvent> events_;
+
+protected:
+    void WriteInnerEvent(int event, std::vector<std::string>& names, std::vector<std::string>& values) override;
+};
+
+class GnssInnerEventAggregatorTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+};
+} // namespace Location
+} // namespace OHOS
+#endif // FEATURE_GNSS_SUPPORT
+#endif // GNSS_INNER_EVENT_AGGREGATOR_TEST_H
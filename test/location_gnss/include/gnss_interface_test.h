@@ -63,6 +63,13 @@ public:
         const sptr<HDI::Location::Gnss::V2_0::IGnssMeasurementCallback> &callbackObj) override;
 
     int32_t DisableGnssMeasurement() override;
+
+    GnssConfigPara configPara_;
+    int setConfigParaCount_ = 0;
+    int enableGnssCount_ = 0;
+    int disableGnssCount_ = 0;
+    int startGnssCount_ = 0;
+    int stopGnssCount_ = 0;
 };
 }  // namespace Location
 }  // namespace OHOS
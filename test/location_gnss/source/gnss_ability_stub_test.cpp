@@ -100,7 +100,7 @@ HWTEST_F(GnssAbilityStubTest, GnssAbilityStubTest004, TestSize.Level0)
         << "GnssAbilityStubTest, GnssAbilityStubTest004, TestSize.Level0";
     LBSLOGI(GNSS, "[GnssAbilityStubTest] GnssAbilityStubTest004 begin");
     auto gnssAbilityStub = sptr<MockGnssAbilityStub>(new (std::nothrow) MockGnssAbilityStub());
-    EXPECT_CALL(*gnssAbilityStub, RegisterGnssStatusCallback(_, _)).WillOnce(DoAll(Return(ERRCODE_SUCCESS)));
+    EXPECT_CALL(*gnssAbilityStub, RegisterGnssStatusCallback(_, _, _)).WillOnce(DoAll(Return(ERRCODE_SUCCESS)));
     MessageParcel parcel;
     parcel.WriteInterfaceToken(GnssAbilityProxy::GetDescriptor());
     MessageParcel reply;
@@ -134,7 +134,7 @@ HWTEST_F(GnssAbilityStubTest, GnssAbilityStubTest006, TestSize.Level0)
         << "GnssAbilityStubTest, GnssAbilityStubTest006, TestSize.Level0";
     LBSLOGI(GNSS, "[GnssAbilityStubTest] GnssAbilityStubTest006 begin");
     auto gnssAbilityStub = sptr<MockGnssAbilityStub>(new (std::nothrow) MockGnssAbilityStub());
-    EXPECT_CALL(*gnssAbilityStub, RegisterNmeaMessageCallback(_, _)).WillOnce(DoAll(Return(ERRCODE_SUCCESS)));
+    EXPECT_CALL(*gnssAbilityStub, RegisterNmeaMessageCallback(_, _, _)).WillOnce(DoAll(Return(ERRCODE_SUCCESS)));
     MessageParcel parcel;
     parcel.WriteInterfaceToken(GnssAbilityProxy::GetDescriptor());
     MessageParcel reply;
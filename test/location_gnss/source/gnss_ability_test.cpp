@@ -16,7 +16,12 @@
 #ifdef FEATURE_GNSS_SUPPORT
 #include "gnss_ability_test.h"
 
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
+#include <thread>
 
 #include "accesstoken_kit.h"
 #include "cell_information.h"
@@ -36,6 +41,7 @@
 
 #include "mock_i_cellular_data_manager.h"
 #include "permission_manager.h"
+#include "proxy_freeze_manager.h"
 #include "geofence_request.h"
 
 #define private public
@@ -72,6 +78,102 @@ constexpr const char *UNLOAD_GNSS_TASK = "gnss_sa_unload";
 constexpr int32_t FENCE_MAX_ID = 1000000;
 const int32_t WAIT_EVENT_TIME = 3;
 const int64_t MAX_BATCH_LENGTH_MS = 24 * 60 * 60 * 1000;
+const int NMEA_REPLAY_SUBSCRIBER_NUM = 5;
+const int NMEA_REPLAY_EPOCH_NUM = 100; // 10s of a 10Hz stream
+const std::vector<std::string> NMEA_REPLAY_EPOCH = {
+    "$GPGGA,092750.000,5321.6802,N,00630.3372,W,1,8,1.03,61.7,M,55.2,M,,*76",
+    "$GPGSA,A,3,10,07,05,02,29,04,08,13,,,,,1.72,1.03,1.38*0A",
+    "$GPGSV,3,1,11,10,63,137,17,07,61,098,15,05,59,290,20,08,54,157,30*70",
+    "$GPGSV,3,2,11,02,39,223,19,13,28,070,17,26,23,252,,04,14,186,14*79",
+    "$GPGSV,3,3,11,29,09,301,24,16,09,020,,36,,,*76",
+    "$GPRMC,092750.000,A,5321.6802,N,00630.3372,W,0.02,31.66,280511,,,A*43",
+    "$GLGSA,A,3,65,66,74,75,,,,,,,,,1.72,1.03,1.38*15",
+    "$GLGSV,2,1,07,65,43,054,26,66,70,305,25,74,36,118,22,75,64,043,28*69",
+    "$GLGSV,2,2,07,76,22,347,,84,11,034,,85,05,081,*5B",
+    "$GAGSA,A,3,02,11,12,,,,,,,,,,1.72,1.03,1.38*1C",
+    "$GAGSV,1,1,03,02,45,120,30,11,60,210,28,12,15,300,22*5E",
+    "$BDGSA,A,3,06,09,16,,,,,,,,,,1.72,1.03,1.38*1A",
+    "$BDGSV,1,1,03,06,58,030,31,09,40,250,27,16,20,110,24*6A",
+    "$GPVTG,31.66,T,,M,0.02,N,0.04,K,A*3A",
+    "$GPZDA,092750.000,28,05,2011,00,00*5D",
+};
+
+const int NMEA_LOCK_SUBSCRIBER_NUM = 100;
+const int NMEA_LOCK_REGISTER_NUM = 200;
+const int64_t NMEA_LOCK_DELIVERY_COST_US = 20; // stands in for one binder transaction
+const int COALESCE_EPOCH_NUM = 30; // 3s of a 10Hz stream
+const int64_t COALESCE_EPOCH_INTERVAL_MS = 100;
+const int32_t COALESCE_SUBSCRIBER_INTERVAL_MS = 1000;
+const int REQUEST_BURST_NUM = 50;
+const int GEOFENCE_STRESS_FENCE_NUM = 1000; // MAX_GNSS_GEOFENCE_REQUEST_NUM
+const int GEOFENCE_STRESS_CALLBACK_NUM = 10;
+const int GEOFENCE_STRESS_EXPIRATION_MS = 3600000;
+const int GEOFENCE_JOURNAL_BENCHMARK_NUMS[] = {100, 500, 1000};
+const int GEOFENCE_JOURNAL_MIGRATE_NUM = 3;
+const std::string GEOFENCE_JOURNAL_TEST_FILE_PATH = "/data/local/tmp/geofenceRequestJournalTest.conf";
+
+class CountingNmeaMessageCallback : public NmeaMessageCallbackNapi {
+public:
+    void OnMessageChange(int64_t timestamp, const std::string msg) override
+    {
+        count_++;
+        lastMsg_ = msg;
+    }
+    int count_ = 0;
+    std::string lastMsg_;
+};
+
+class CountingGnssStatusCallback : public GnssStatusCallbackNapi {
+public:
+    void OnStatusChange(const std::unique_ptr<SatelliteStatus>& statusInfo) override
+    {
+        count_++;
+    }
+    int count_ = 0;
+};
+
+class SlowNmeaMessageCallback : public NmeaMessageCallbackNapi {
+public:
+    void OnMessageChange(int64_t timestamp, const std::string msg) override
+    {
+        auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(NMEA_LOCK_DELIVERY_COST_US);
+        while (std::chrono::steady_clock::now() < end) {
+        }
+        count_++;
+    }
+    std::atomic<int> count_{0};
+};
+
+static void AddBurstRequest(WorkRecord& workRecord, int index)
+{
+    std::shared_ptr<Request> request = std::make_shared<Request>();
+    std::unique_ptr<RequestConfig> requestConfig = std::make_unique<RequestConfig>();
+    requestConfig->SetTimeInterval(1);
+    request->SetUid(index + 1);
+    request->SetPid(index + 2);
+    request->SetPackageName("nameForTest" + std::to_string(index));
+    request->SetRequestConfig(*requestConfig);
+    request->SetUuid(std::to_string(index));
+    workRecord.Add(request);
+}
+
+static std::shared_ptr<GeofenceRequest> CreatePersistentGeofenceRequest(int fenceId)
+{
+    std::shared_ptr<GeofenceRequest> request = std::make_shared<GeofenceRequest>();
+    GeoFence fence;
+    fence.latitude = 1.0;
+    fence.longitude = 1.0;
+    fence.radius = 100.0;
+    fence.expiration = GEOFENCE_STRESS_EXPIRATION_MS;
+    request->SetGeofence(fence);
+    request->SetFenceId(fenceId);
+    request->SetBundleName("GeofenceJournalTest");
+    // requests without a want agent, notification or extension ability are not persisted
+    request->SetFenceExtensionAbilityName("GeofenceJournalTestExtension");
+    request->SetRequestExpirationTimeStamp(CommonUtils::GetCurrentTimeMilSec() + GEOFENCE_STRESS_EXPIRATION_MS);
+    return request;
+}
+
 void GnssAbilityTest::SetUp()
 {
     /*
@@ -239,7 +341,7 @@ HWTEST_F(GnssAbilityTest, RegisterGnssStatusCallback001, TestSize.Level1)
      * @tc.steps: step2. test register gnss status callback
      * @tc.expected: log info : "SendRegisterMsgToRemote callback is nullptr".
      */
-    EXPECT_EQ(LOCATION_ERRCODE_INVALID_PARAM, proxy_->RegisterGnssStatusCallback(client, identity));
+    EXPECT_EQ(LOCATION_ERRCODE_INVALID_PARAM, proxy_->RegisterGnssStatusCallback(client, identity, 0));
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] RegisterGnssStatusCallback001 end");
 }
 
@@ -264,7 +366,7 @@ HWTEST_F(GnssAbilityTest, RegisterAndUnregisterGnssStatusCallback001, TestSize.L
      * @tc.steps: step2. test register gnss status callback
      * @tc.expected: no exception happens.
      */
-    EXPECT_EQ(ERRCODE_SUCCESS, proxy_->RegisterGnssStatusCallback(callbackStub_->AsObject(), identity));
+    EXPECT_EQ(ERRCODE_SUCCESS, proxy_->RegisterGnssStatusCallback(callbackStub_->AsObject(), identity, 0));
 
     /*
      * @tc.steps: step3. test unregister gnss status callback
@@ -319,7 +421,7 @@ HWTEST_F(GnssAbilityTest, RegisterNmeaMessageCallback001, TestSize.Level1)
      * @tc.steps: step2. test register nmea message callback
      * @tc.expected: log info : "register an invalid nmea callback".
      */
-    EXPECT_EQ(LOCATION_ERRCODE_INVALID_PARAM, proxy_->RegisterNmeaMessageCallback(client, identity));
+    EXPECT_EQ(LOCATION_ERRCODE_INVALID_PARAM, proxy_->RegisterNmeaMessageCallback(client, identity, 0));
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] RegisterNmeaMessageCallback001 end");
 }
 
@@ -344,7 +446,7 @@ HWTEST_F(GnssAbilityTest, RegisterAndUnregisterNmeaMessageCallback001, TestSize.
      * @tc.steps: step2. test register nmea message callback
      * @tc.expected: no exception happens
      */
-    EXPECT_EQ(ERRCODE_SUCCESS, proxy_->RegisterNmeaMessageCallback(nemaCallbackStub_->AsObject(), identity));
+    EXPECT_EQ(ERRCODE_SUCCESS, proxy_->RegisterNmeaMessageCallback(nemaCallbackStub_->AsObject(), identity, 0));
 
     /*
      * @tc.steps: step3. test unregister nmea message callback
@@ -759,7 +861,7 @@ HWTEST_F(GnssAbilityTest, GnssAbilityReportSv001, TestSize.Level1)
     AppIdentity identity;
     identity.SetPid(uid);
     identity.SetUid(23);
-    ability_->RegisterGnssStatusCallback(callbackStub_->AsObject(), identity);
+    ability_->RegisterGnssStatusCallback(callbackStub_->AsObject(), identity, 0);
     ability_->ReportSv(status);
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GnssAbilityReportSv001 end");
 }
@@ -1024,7 +1126,7 @@ HWTEST_F(GnssAbilityTest, GnssEventCallbackReportNmea003, TestSize.Level1)
     AppIdentity identity;
     identity.SetPid(uid);
     identity.SetUid(23);
-    ability_->RegisterNmeaMessageCallback(nemaCallbackStub_->AsObject(), identity);
+    ability_->RegisterNmeaMessageCallback(nemaCallbackStub_->AsObject(), identity, 0);
     ability_->ReportNmea(1745722410, "nmea");
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GnssEventCallbackReportNmea003 end");
 }
@@ -2092,6 +2194,74 @@ HWTEST_F(GnssAbilityTest, QuerySupportCoordinateSystemType001, TestSize.Level1)
     LBSLOGI(LOCATOR, "[GnssAbilityTest] QuerySupportCoordinateSystemType001 end");
 }
 
+HWTEST_F(GnssAbilityTest, GeofenceRegistryStress001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, GeofenceRegistryStress001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GeofenceRegistryStress001 begin");
+    // GeofenceEventCallback reports into the singleton, so the registry under test is the singleton's
+    auto gnssAbility = GnssAbility::GetInstance();
+    std::vector<sptr<IRemoteObject>> callbacks;
+    for (int i = 0; i < GEOFENCE_STRESS_CALLBACK_NUM; i++) {
+        sptr<LocationGnssGeofenceCallbackNapi> callbackHost = new LocationGnssGeofenceCallbackNapi();
+        callbacks.push_back(callbackHost->AsObject());
+    }
+    GeoFence fence;
+    fence.latitude = 1.0;
+    fence.longitude = 1.0;
+    fence.radius = 100.0;
+    fence.expiration = GEOFENCE_STRESS_EXPIRATION_MS;
+    for (int fenceId = 1; fenceId <= GEOFENCE_STRESS_FENCE_NUM; fenceId++) {
+        std::shared_ptr<GeofenceRequest> request = std::make_shared<GeofenceRequest>();
+        request->SetFenceId(fenceId);
+        request->SetBundleName("GeofenceRegistryStress" + std::to_string(fenceId % GEOFENCE_STRESS_CALLBACK_NUM));
+        request->SetGeofence(fence);
+        EXPECT_EQ(true, gnssAbility->RegisterGnssGeofenceCallback(request,
+            callbacks[fenceId % GEOFENCE_STRESS_CALLBACK_NUM]));
+    }
+    EXPECT_EQ(GEOFENCE_STRESS_FENCE_NUM, gnssAbility->GetGnssGeofenceRequestMapSize());
+    EXPECT_EQ(GEOFENCE_STRESS_CALLBACK_NUM, gnssAbility->gnssGeofenceCallbackMap_.size());
+
+    sptr<GeofenceEventCallback> geofenceCallback = new (std::nothrow) GeofenceEventCallback();
+    ASSERT_NE(nullptr, geofenceCallback);
+    HDI::Location::Geofence::V2_0::LocationInfo location;
+    location.latitude = fence.latitude;
+    location.longitude = fence.longitude;
+    auto begin = std::chrono::steady_clock::now();
+    for (int fenceId = 1; fenceId <= GEOFENCE_STRESS_FENCE_NUM; fenceId++) {
+        geofenceCallback->ReportGeofenceEvent(fenceId, location, GeofenceEvent::GEOFENCE_EVENT_ENTERED,
+            CommonUtils::GetCurrentTimeMilSec());
+        geofenceCallback->ReportGeofenceEvent(fenceId, location, GeofenceEvent::GEOFENCE_EVENT_EXITED,
+            CommonUtils::GetCurrentTimeMilSec());
+    }
+    // unknown fence ids must miss the index without disturbing it
+    geofenceCallback->ReportGeofenceEvent(GEOFENCE_STRESS_FENCE_NUM + 1, location,
+        GeofenceEvent::GEOFENCE_EVENT_ENTERED, CommonUtils::GetCurrentTimeMilSec());
+    auto costUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] %{public}d transitions cost %{public}lld us",
+        GEOFENCE_STRESS_FENCE_NUM * 2, static_cast<long long>(costUs));
+    EXPECT_EQ(GEOFENCE_STRESS_FENCE_NUM, gnssAbility->GetGnssGeofenceRequestMapSize());
+
+    for (int fenceId = 1; fenceId <= GEOFENCE_STRESS_FENCE_NUM; fenceId++) {
+        std::shared_ptr<GeofenceRequest> request = std::make_shared<GeofenceRequest>();
+        request->SetFenceId(fenceId);
+        request->SetBundleName("GeofenceRegistryStress" + std::to_string(fenceId % GEOFENCE_STRESS_CALLBACK_NUM));
+        EXPECT_EQ(true, gnssAbility->IsDuplicateAddRequestForGnssGeofence(request));
+        request->SetBundleName("GeofenceRegistryStressOther");
+        EXPECT_EQ(false, gnssAbility->IsDuplicateAddRequestForGnssGeofence(request));
+    }
+    EXPECT_EQ(true, gnssAbility->RemoveGnssGeofenceByCallbackWhenAppDie(callbacks[0]));
+
+    for (int fenceId = 1; fenceId <= GEOFENCE_STRESS_FENCE_NUM; fenceId++) {
+        gnssAbility->UnregisterGnssGeofenceCallback(fenceId);
+    }
+    EXPECT_EQ(0, gnssAbility->GetGnssGeofenceRequestMapSize());
+    EXPECT_EQ(0, gnssAbility->gnssGeofenceCallbackMap_.size());
+    EXPECT_EQ(0, gnssAbility->gnssGeofenceRequestCountMap_.size());
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GeofenceRegistryStress001 end");
+}
+
 #endif
 
 HWTEST_F(GnssAbilityTest, ReConnectHdiImpl001, TestSize.Level1)
@@ -3144,6 +3314,126 @@ HWTEST_F(GnssAbilityTest, ReadGeoFenceRequestFromFileTest001, TestSize.Level1)
     LBSLOGI(LOCATOR, "[GnssAbilityTest] ReadGeoFenceRequestFromFileTest001 end");
 }
 
+HWTEST_F(GnssAbilityTest, GeofenceJournalBenchmark001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, GeofenceJournalBenchmark001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GeofenceJournalBenchmark001 begin");
+    ability_->geofenceRequestFilePath_ = GEOFENCE_JOURNAL_TEST_FILE_PATH;
+    for (int fenceNum : GEOFENCE_JOURNAL_BENCHMARK_NUMS) {
+        std::remove(GEOFENCE_JOURNAL_TEST_FILE_PATH.c_str());
+        ability_->geofenceJournalRecordNum_ = 0;
+        ability_->geofenceJournalLiveNum_ = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (int fenceId = 1; fenceId <= fenceNum; fenceId++) {
+            auto request = CreatePersistentGeofenceRequest(fenceId);
+            ability_->AddGnssGeofenceRequest(request);
+            ability_->AppendGeoFenceRequestToFile(request, false);
+        }
+        auto addCostUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+
+        begin = std::chrono::steady_clock::now();
+        auto requestList = ability_->ReadGeoFenceRequestFromFile();
+        auto restoreCostUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+        EXPECT_EQ(fenceNum, requestList.size());
+
+        begin = std::chrono::steady_clock::now();
+        for (int fenceId = 1; fenceId <= fenceNum; fenceId++) {
+            auto request = ability_->EraseGnssGeofenceRequest(fenceId);
+            ASSERT_NE(nullptr, request);
+            ability_->AppendGeoFenceRequestToFile(request, true);
+        }
+        auto removeCostUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+        EXPECT_EQ(0, ability_->ReadGeoFenceRequestFromFile().size());
+        LBSLOGI(GNSS_TEST, "[GnssAbilityTest] %{public}d fences, add %{public}lld us, remove %{public}lld us, "
+            "restore %{public}lld us", fenceNum, static_cast<long long>(addCostUs),
+            static_cast<long long>(removeCostUs), static_cast<long long>(restoreCostUs));
+    }
+    std::remove(GEOFENCE_JOURNAL_TEST_FILE_PATH.c_str());
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GeofenceJournalBenchmark001 end");
+}
+
+HWTEST_F(GnssAbilityTest, GeofenceJournalMigrate001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, GeofenceJournalMigrate001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GeofenceJournalMigrate001 begin");
+    ability_->geofenceRequestFilePath_ = GEOFENCE_JOURNAL_TEST_FILE_PATH;
+    // the snapshot format written before the journal, {fenceId: request json string}
+    nlohmann::json legacyRoot = nlohmann::json::object();
+    for (int fenceId = 1; fenceId <= GEOFENCE_JOURNAL_MIGRATE_NUM; fenceId++) {
+        nlohmann::json jsonObject;
+        CreatePersistentGeofenceRequest(fenceId)->ToJson(jsonObject);
+        legacyRoot[std::to_string(fenceId)] = jsonObject.dump();
+    }
+    std::ofstream legacyFs(GEOFENCE_JOURNAL_TEST_FILE_PATH, std::ofstream::out | std::ofstream::trunc);
+    legacyFs << legacyRoot.dump(1, '\t');
+    legacyFs.close();
+    auto requestList = ability_->ReadGeoFenceRequestFromFile();
+    EXPECT_EQ(GEOFENCE_JOURNAL_MIGRATE_NUM, requestList.size());
+
+    for (auto& request : requestList) {
+        ability_->AddGnssGeofenceRequest(request);
+    }
+    ability_->SaveGeoFenceRequestToFile();
+    EXPECT_EQ('+', ability_->ReadFileContent()[0]);
+    EXPECT_EQ(GEOFENCE_JOURNAL_MIGRATE_NUM, ability_->ReadGeoFenceRequestFromFile().size());
+
+    // a record torn by a crash while appending is dropped, the complete ones survive
+    std::ofstream tornFs(GEOFENCE_JOURNAL_TEST_FILE_PATH, std::ofstream::out | std::ofstream::app);
+    tornFs << "-1";
+    tornFs.close();
+    EXPECT_EQ(GEOFENCE_JOURNAL_MIGRATE_NUM, ability_->ReadGeoFenceRequestFromFile().size());
+    ability_->gnssGeofenceRequestMap_.clear();
+    ability_->gnssGeofenceRequestCountMap_.clear();
+    std::remove(GEOFENCE_JOURNAL_TEST_FILE_PATH.c_str());
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GeofenceJournalMigrate001 end");
+}
+
+HWTEST_F(GnssAbilityTest, GeofenceJournalRecover001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, GeofenceJournalRecover001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GeofenceJournalRecover001 begin");
+    ability_->geofenceRequestFilePath_ = GEOFENCE_JOURNAL_TEST_FILE_PATH;
+    std::remove(GEOFENCE_JOURNAL_TEST_FILE_PATH.c_str());
+    ability_->geofenceJournalRecordNum_ = 0;
+    ability_->geofenceJournalLiveNum_ = 0;
+    for (int fenceId = 1; fenceId <= GEOFENCE_JOURNAL_MIGRATE_NUM; fenceId++) {
+        auto request = CreatePersistentGeofenceRequest(fenceId);
+        ability_->AddGnssGeofenceRequest(request);
+        ability_->AppendGeoFenceRequestToFile(request, false);
+    }
+    // a damaged record in the middle is skipped instead of dropping the whole journal
+    std::ofstream badFs(GEOFENCE_JOURNAL_TEST_FILE_PATH, std::ofstream::out | std::ofstream::app);
+    badFs << "+{damaged\n" << "garbage\n";
+    badFs.close();
+    EXPECT_EQ(GEOFENCE_JOURNAL_MIGRATE_NUM, ability_->ReadGeoFenceRequestFromFile().size());
+
+    // a torn tail is cut off before the next record is appended, so the new record is not swallowed
+    std::ofstream tornFs(GEOFENCE_JOURNAL_TEST_FILE_PATH, std::ofstream::out | std::ofstream::app);
+    tornFs << "-1";
+    tornFs.close();
+    auto request = CreatePersistentGeofenceRequest(GEOFENCE_JOURNAL_MIGRATE_NUM + 1);
+    ability_->AddGnssGeofenceRequest(request);
+    ability_->AppendGeoFenceRequestToFile(request, false);
+    EXPECT_EQ(GEOFENCE_JOURNAL_MIGRATE_NUM + 1, ability_->ReadGeoFenceRequestFromFile().size());
+
+    // compaction keeps fences without a callback type as the snapshot did
+    auto plainRequest = CreatePersistentGeofenceRequest(GEOFENCE_JOURNAL_MIGRATE_NUM + 2);
+    plainRequest->SetFenceExtensionAbilityName("");
+    ability_->AddGnssGeofenceRequest(plainRequest);
+    ability_->SaveGeoFenceRequestToFile();
+    EXPECT_EQ(GEOFENCE_JOURNAL_MIGRATE_NUM + 2, ability_->ReadGeoFenceRequestFromFile().size());
+    ability_->gnssGeofenceRequestMap_.clear();
+    ability_->gnssGeofenceRequestCountMap_.clear();
+    std::remove(GEOFENCE_JOURNAL_TEST_FILE_PATH.c_str());
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GeofenceJournalRecover001 end");
+}
+
 HWTEST_F(GnssAbilityTest, ReportGeofenceEvent002, TestSize.Level1)
 {
     GTEST_LOG_(INFO)
@@ -3196,8 +3486,9 @@ HWTEST_F(GnssAbilityTest, IsGnssfenceRequestExist001, TestSize.Level1)
     ability_->RegisterGnssGeofenceCallback(request, callbackHost->AsObject());
     result = ability_->IsGnssfenceRequestExist();
     EXPECT_EQ(true, result);
-    ability_->gnssGeofenceRequestList_.clear();
+    ability_->gnssGeofenceRequestMap_.clear();
     ability_->gnssGeofenceRequestCountMap_.clear();
+    ability_->gnssGeofenceCallbackMap_.clear();
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] IsGnssfenceRequestExist001 end");
 }
 
@@ -3239,7 +3530,7 @@ HWTEST_F(GnssAbilityTest, SaveFenceWantAgentInfo003, TestSize.Level1)
     request->SetGeofence(fence);
     bool result = ability_->SaveFenceWantAgentInfo(request);
     EXPECT_EQ(false, result);
-    ability_->gnssGeofenceRequestList_.clear();
+    ability_->gnssGeofenceRequestMap_.clear();
     ability_->gnssGeofenceRequestCountMap_.clear();
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] SaveFenceWantAgentInfo003 end");
 }
@@ -3317,9 +3608,9 @@ HWTEST_F(GnssAbilityTest, DeleteMinExpirationGeofenceRequest001, TestSize.Level1
     std::shared_ptr<GeofenceRequest> request = std::make_shared<GeofenceRequest>();
     request->SetBundleName("test_bundle_name");
     request->SetRequestExpirationTimeStamp(LLONG_MAX);
-    ability_->gnssGeofenceRequestList_.push_back(request);
+    ability_->gnssGeofenceRequestMap_[request->GetFenceId()] = request;
     ability_->DeleteMinExpirationGeofenceRequest("test_bundle_name");
-    ability_->gnssGeofenceRequestList_.clear();
+    ability_->gnssGeofenceRequestMap_.clear();
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] DeleteMinExpirationGeofenceRequest001 end");
 }
 
@@ -3339,10 +3630,10 @@ HWTEST_F(GnssAbilityTest, GetGnssGeofenceRequestMapSize002, TestSize.Level1)
         << "GnssAbilityTest, GetGnssGeofenceRequestMapSize002, TestSize.Level1";
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GetGnssGeofenceRequestMapSize002 begin");
     std::shared_ptr<GeofenceRequest> request = std::make_shared<GeofenceRequest>();
-    ability_->gnssGeofenceRequestList_.push_back(request);
+    ability_->gnssGeofenceRequestMap_[request->GetFenceId()] = request;
     size_t result = ability_->GetGnssGeofenceRequestMapSize();
     EXPECT_EQ(1, result);
-    ability_->gnssGeofenceRequestList_.clear();
+    ability_->gnssGeofenceRequestMap_.clear();
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] GetGnssGeofenceRequestMapSize002 end");
 }
 
@@ -3434,6 +3725,367 @@ HWTEST_F(GnssAbilityTest, IsSupportBatching001, TestSize.Level1)
     bool isSupported = ability_->IsSupportBatching();
     LBSLOGI(GNSS_TEST, "[GnssAbilityTest] IsSupportBatching001 end");
 }
+
+HWTEST_F(GnssAbilityTest, ReportNmeaReplayBenchmark001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, ReportNmeaReplayBenchmark001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] ReportNmeaReplayBenchmark001 begin");
+    std::vector<sptr<CountingNmeaMessageCallback>> callbacks;
+    for (int i = 0; i < NMEA_REPLAY_SUBSCRIBER_NUM; i++) {
+        sptr<CountingNmeaMessageCallback> callback = new (std::nothrow) CountingNmeaMessageCallback();
+        ASSERT_NE(nullptr, callback);
+        AppIdentity identity;
+        identity.SetPid(getpid() + i + 1);
+        identity.SetUid(getuid());
+        identity.SetTokenId(IPCSkeleton::GetSelfTokenID());
+        EXPECT_EQ(ERRCODE_SUCCESS, ability_->RegisterNmeaMessageCallback(callback->AsObject(), identity, 0));
+        callbacks.push_back(callback);
+    }
+    auto& subscriber = ability_->nmeaCallbackMap_[callbacks.front()->AsObject()];
+    bool isDeliverable = ability_->IsSubscriberDeliverable(subscriber, "ReportNmea");
+    int sentenceNum = NMEA_REPLAY_EPOCH_NUM * static_cast<int>(NMEA_REPLAY_EPOCH.size());
+
+    // every sentence re-evaluates every subscriber, as before the deliverable flag
+    auto start = std::chrono::steady_clock::now();
+    for (int epoch = 0; epoch < NMEA_REPLAY_EPOCH_NUM; epoch++) {
+        for (const auto& sentence : NMEA_REPLAY_EPOCH) {
+            PermissionManager::InvalidatePermissionState();
+            ability_->ReportNmea(epoch * 100, sentence);
+        }
+    }
+    auto uncachedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    // the flag is only recomputed on permission, account or freeze changes
+    start = std::chrono::steady_clock::now();
+    for (int epoch = 0; epoch < NMEA_REPLAY_EPOCH_NUM; epoch++) {
+        for (const auto& sentence : NMEA_REPLAY_EPOCH) {
+            ability_->ReportNmea(epoch * 100, sentence);
+        }
+    }
+    auto cachedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    GTEST_LOG_(INFO) << NMEA_REPLAY_SUBSCRIBER_NUM << " subscribers, per sentence: uncached "
+        << uncachedNs / sentenceNum << "ns, cached " << cachedNs / sentenceNum << "ns";
+    EXPECT_EQ(isDeliverable ? 2 * sentenceNum : 0, callbacks.front()->count_);
+
+    // freezing the subscriber takes effect on the next sentence
+    ProxyFreezeManager::GetInstance()->ProxyForFreeze({subscriber.identity.GetPid()}, true);
+    int countBeforeFreeze = callbacks.front()->count_;
+    ability_->ReportNmea(0, NMEA_REPLAY_EPOCH.front());
+    EXPECT_EQ(countBeforeFreeze, callbacks.front()->count_);
+    EXPECT_EQ(false, subscriber.isDeliverable);
+    ProxyFreezeManager::GetInstance()->ResetAllProxy();
+    ability_->ReportNmea(0, NMEA_REPLAY_EPOCH.front());
+    EXPECT_EQ(isDeliverable ? countBeforeFreeze + 1 : countBeforeFreeze, callbacks.front()->count_);
+
+    for (auto& callback : callbacks) {
+        ability_->UnregisterNmeaMessageCallback(callback->AsObject());
+    }
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] ReportNmeaReplayBenchmark001 end");
+}
+
+HWTEST_F(GnssAbilityTest, ReportNmeaLockHoldBenchmark001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, ReportNmeaLockHoldBenchmark001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] ReportNmeaLockHoldBenchmark001 begin");
+    std::vector<sptr<SlowNmeaMessageCallback>> callbacks;
+    for (int i = 0; i < NMEA_LOCK_SUBSCRIBER_NUM; i++) {
+        sptr<SlowNmeaMessageCallback> callback = new (std::nothrow) SlowNmeaMessageCallback();
+        ASSERT_NE(nullptr, callback);
+        AppIdentity identity;
+        identity.SetPid(getpid() + i + 1);
+        identity.SetUid(getuid());
+        identity.SetTokenId(IPCSkeleton::GetSelfTokenID());
+        EXPECT_EQ(ERRCODE_SUCCESS, ability_->RegisterNmeaMessageCallback(callback->AsObject(), identity, 0));
+        callbacks.push_back(callback);
+    }
+
+    // high-rate stream on another thread, each sentence costs one delivery per subscriber
+    std::atomic<bool> stop(false);
+    std::atomic<int> sentenceNum(0);
+    std::atomic<int64_t> maxLockHoldNs(0);
+    std::thread stream([this, &stop, &sentenceNum, &maxLockHoldNs]() {
+        while (!stop.load()) {
+            for (const auto& sentence : NMEA_REPLAY_EPOCH) {
+                ability_->ReportNmea(0, sentence);
+                sentenceNum++;
+            }
+            // lock hold time of the snapshot is what a register call can be blocked by
+            auto start = std::chrono::steady_clock::now();
+            {
+                std::unique_lock<ffrt::mutex> lock(ability_->nmeaMutex_);
+                for (auto& pair : ability_->nmeaCallbackMap_) {
+                    ability_->IsSubscriberDeliverable(pair.second, "ReportNmea");
+                }
+            }
+            int64_t holdNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            if (holdNs > maxLockHoldNs.load()) {
+                maxLockHoldNs = holdNs;
+            }
+        }
+    });
+
+    int64_t totalRegisterNs = 0;
+    int64_t maxRegisterNs = 0;
+    sptr<CountingNmeaMessageCallback> probe = new (std::nothrow) CountingNmeaMessageCallback();
+    ASSERT_NE(nullptr, probe);
+    AppIdentity probeIdentity;
+    probeIdentity.SetTokenId(IPCSkeleton::GetSelfTokenID());
+    for (int i = 0; i < NMEA_LOCK_REGISTER_NUM; i++) {
+        auto start = std::chrono::steady_clock::now();
+        ability_->RegisterNmeaMessageCallback(probe->AsObject(), probeIdentity, 0);
+        ability_->UnregisterNmeaMessageCallback(probe->AsObject());
+        int64_t costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        totalRegisterNs += costNs;
+        maxRegisterNs = std::max(maxRegisterNs, costNs);
+    }
+    stop = true;
+    stream.join();
+    int64_t oneSentenceDeliveryUs = NMEA_LOCK_SUBSCRIBER_NUM * NMEA_LOCK_DELIVERY_COST_US;
+    GTEST_LOG_(INFO) << NMEA_LOCK_SUBSCRIBER_NUM << " subscribers, " << sentenceNum.load()
+        << " sentences, max lock hold " << maxLockHoldNs.load() / 1000 << "us, register+unregister avg "
+        << totalRegisterNs / NMEA_LOCK_REGISTER_NUM / 1000 << "us max " << maxRegisterNs / 1000
+        << "us, delivery of one sentence ~" << oneSentenceDeliveryUs << "us";
+
+    for (auto& callback : callbacks) {
+        ability_->UnregisterNmeaMessageCallback(callback->AsObject());
+    }
+    EXPECT_EQ(0, static_cast<int>(ability_->nmeaCallbackMap_.size()));
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] ReportNmeaLockHoldBenchmark001 end");
+}
+
+HWTEST_F(GnssAbilityTest, ReportCoalescedSubscriberIpcCount001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, ReportCoalescedSubscriberIpcCount001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] ReportCoalescedSubscriberIpcCount001 begin");
+    AppIdentity identity;
+    identity.SetPid(getpid() + 1);
+    identity.SetUid(getuid());
+    identity.SetTokenId(IPCSkeleton::GetSelfTokenID());
+    sptr<CountingNmeaMessageCallback> nativeNmea = new (std::nothrow) CountingNmeaMessageCallback();
+    sptr<CountingNmeaMessageCallback> coalescedNmea = new (std::nothrow) CountingNmeaMessageCallback();
+    sptr<CountingGnssStatusCallback> nativeSv = new (std::nothrow) CountingGnssStatusCallback();
+    sptr<CountingGnssStatusCallback> coalescedSv = new (std::nothrow) CountingGnssStatusCallback();
+    ASSERT_NE(nullptr, nativeNmea);
+    ASSERT_NE(nullptr, coalescedNmea);
+    ASSERT_NE(nullptr, nativeSv);
+    ASSERT_NE(nullptr, coalescedSv);
+    EXPECT_EQ(LOCATION_ERRCODE_INVALID_PARAM,
+        ability_->RegisterNmeaMessageCallback(coalescedNmea->AsObject(), identity, -1));
+    EXPECT_EQ(ERRCODE_SUCCESS, ability_->RegisterNmeaMessageCallback(nativeNmea->AsObject(), identity, 0));
+    EXPECT_EQ(ERRCODE_SUCCESS, ability_->RegisterNmeaMessageCallback(coalescedNmea->AsObject(), identity,
+        COALESCE_SUBSCRIBER_INTERVAL_MS));
+    EXPECT_EQ(ERRCODE_SUCCESS, ability_->RegisterGnssStatusCallback(nativeSv->AsObject(), identity, 0));
+    EXPECT_EQ(ERRCODE_SUCCESS, ability_->RegisterGnssStatusCallback(coalescedSv->AsObject(), identity,
+        COALESCE_SUBSCRIBER_INTERVAL_MS));
+    bool isDeliverable = ability_->IsSubscriberDeliverable(
+        ability_->nmeaCallbackMap_[nativeNmea->AsObject()], "ReportNmea");
+
+    // replay a 10Hz chipset stream, every epoch carries one status and a block of sentences
+    std::unique_ptr<SatelliteStatus> status = std::make_unique<SatelliteStatus>();
+    for (int epoch = 0; epoch < COALESCE_EPOCH_NUM; epoch++) {
+        ability_->ReportSv(status);
+        for (const auto& sentence : NMEA_REPLAY_EPOCH) {
+            ability_->ReportNmea(epoch * COALESCE_EPOCH_INTERVAL_MS, sentence);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(COALESCE_EPOCH_INTERVAL_MS));
+    }
+    GTEST_LOG_(INFO) << "ipc count over " << COALESCE_EPOCH_NUM << " epochs, native rate: sv " << nativeSv->count_
+        << " nmea " << nativeNmea->count_ << ", 1Hz: sv " << coalescedSv->count_
+        << " nmea " << coalescedNmea->count_;
+    int sentenceNum = COALESCE_EPOCH_NUM * static_cast<int>(NMEA_REPLAY_EPOCH.size());
+    int maxCoalescedNum =
+        static_cast<int>(COALESCE_EPOCH_NUM * COALESCE_EPOCH_INTERVAL_MS / COALESCE_SUBSCRIBER_INTERVAL_MS) + 1;
+    EXPECT_EQ(isDeliverable ? COALESCE_EPOCH_NUM : 0, nativeSv->count_);
+    EXPECT_EQ(isDeliverable ? sentenceNum : 0, nativeNmea->count_);
+    EXPECT_LE(coalescedSv->count_, maxCoalescedNum);
+    EXPECT_LE(coalescedNmea->count_, maxCoalescedNum);
+    if (isDeliverable) {
+        EXPECT_GE(coalescedSv->count_, maxCoalescedNum - 1);
+        EXPECT_GE(coalescedNmea->count_, maxCoalescedNum - 1);
+        // a coalesced block holds every sentence of its interval, one per line
+        EXPECT_NE(std::string::npos, coalescedNmea->lastMsg_.find(NMEA_REPLAY_EPOCH.front()));
+        EXPECT_NE(std::string::npos, coalescedNmea->lastMsg_.find(NMEA_REPLAY_EPOCH.back()));
+    }
+
+    ability_->UnregisterNmeaMessageCallback(nativeNmea->AsObject());
+    ability_->UnregisterNmeaMessageCallback(coalescedNmea->AsObject());
+    ability_->UnregisterGnssStatusCallback(nativeSv->AsObject());
+    ability_->UnregisterGnssStatusCallback(coalescedSv->AsObject());
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] ReportCoalescedSubscriberIpcCount001 end");
+}
+
+HWTEST_F(GnssAbilityTest, FlushCoalescedNmea001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, FlushCoalescedNmea001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] FlushCoalescedNmea001 begin");
+    AppIdentity identity;
+    identity.SetPid(getpid() + 1);
+    identity.SetUid(getuid());
+    identity.SetTokenId(IPCSkeleton::GetSelfTokenID());
+    sptr<CountingNmeaMessageCallback> coalescedNmea = new (std::nothrow) CountingNmeaMessageCallback();
+    ASSERT_NE(nullptr, coalescedNmea);
+    EXPECT_EQ(ERRCODE_SUCCESS, ability_->RegisterNmeaMessageCallback(coalescedNmea->AsObject(), identity,
+        COALESCE_SUBSCRIBER_INTERVAL_MS));
+    auto& subscriber = ability_->nmeaCallbackMap_[coalescedNmea->AsObject()];
+    bool isDeliverable = ability_->IsSubscriberDeliverable(subscriber, "ReportNmea");
+
+    // the first sentence opens the interval, the rest of the epoch is held and a flush is armed
+    for (const auto& sentence : NMEA_REPLAY_EPOCH) {
+        ability_->ReportNmea(0, sentence);
+    }
+    EXPECT_EQ(isDeliverable ? 1 : 0, coalescedNmea->count_);
+    EXPECT_EQ(isDeliverable, !subscriber.pendingNmea.empty());
+    EXPECT_EQ(isDeliverable, ability_->nmeaFlushTime_ > 0);
+    ability_->FlushPendingNmea(false);
+    EXPECT_EQ(isDeliverable ? 1 : 0, coalescedNmea->count_);
+
+    // the stream stops, the armed flush delivers the held block once the interval has passed
+    std::this_thread::sleep_for(std::chrono::milliseconds(COALESCE_SUBSCRIBER_INTERVAL_MS));
+    ability_->FlushPendingNmea(false);
+    EXPECT_EQ(isDeliverable ? 2 : 0, coalescedNmea->count_);
+    EXPECT_EQ(true, subscriber.pendingNmea.empty());
+    EXPECT_EQ(0, ability_->nmeaFlushTime_);
+    if (isDeliverable) {
+        EXPECT_NE(std::string::npos, coalescedNmea->lastMsg_.find(NMEA_REPLAY_EPOCH.back()));
+    }
+
+    // a stopping session delivers what is held without waiting, nothing is left for the next session
+    ability_->ReportNmea(COALESCE_EPOCH_INTERVAL_MS, NMEA_REPLAY_EPOCH.front());
+    ability_->FlushPendingNmea(true);
+    EXPECT_EQ(isDeliverable ? 3 : 0, coalescedNmea->count_);
+    EXPECT_EQ(true, subscriber.pendingNmea.empty());
+
+    ability_->UnregisterNmeaMessageCallback(coalescedNmea->AsObject());
+    EXPECT_EQ(ability_->nmeaCallbackMap_.end(), ability_->nmeaCallbackMap_.find(coalescedNmea->AsObject()));
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] FlushCoalescedNmea001 end");
+}
+
+HWTEST_F(GnssAbilityTest, UpdateFixIntervalByRequest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, UpdateFixIntervalByRequest001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] UpdateFixIntervalByRequest001 begin");
+    // request time intervals in s -> expected fix interval in ms
+    std::vector<std::pair<std::vector<int>, int64_t>> requestMixes = {
+        {{0}, 1000},
+        {{1}, 1000},
+        {{10}, 10000},
+        {{10, 60}, 10000},
+        {{60, 0}, 1000},
+        {{30, 5, 120}, 5000},
+        {{600}, 60000},
+    };
+    sptr<GnssInterfaceTest> gnssInterface = new (std::nothrow) GnssInterfaceTest();
+    ASSERT_NE(nullptr, gnssInterface);
+    for (auto& requestMix : requestMixes) {
+        WorkRecord workRecord;
+        for (size_t i = 0; i < requestMix.first.size(); i++) {
+            std::shared_ptr<Request> request = std::make_shared<Request>();
+            std::unique_ptr<RequestConfig> requestConfig = std::make_unique<RequestConfig>();
+            requestConfig->SetTimeInterval(requestMix.first[i]);
+            request->SetUid(i + 1);
+            request->SetPid(i + 2);
+            request->SetPackageName("nameForTest");
+            request->SetRequestConfig(*requestConfig);
+            request->SetUuid(std::to_string(CommonUtils::IntRandom(MIN_INT_RANDOM, MAX_INT_RANDOM)));
+            workRecord.Add(request);
+        }
+        ability_->LocationRequest(workRecord);
+        EXPECT_EQ(requestMix.second, ability_->fixInterval_);
+
+        // the hdi gets the fix interval whether or not a supl working mode is set on the device
+        int setConfigParaCount = gnssInterface->setConfigParaCount_;
+        EXPECT_EQ(ERRCODE_SUCCESS, ability_->SetPositionMode(gnssInterface));
+        EXPECT_EQ(setConfigParaCount + 1, gnssInterface->setConfigParaCount_);
+        EXPECT_EQ(static_cast<uint32_t>(requestMix.second), gnssInterface->configPara_.gnssBasic.minInterval);
+    }
+    WorkRecord emptyRecord;
+    ability_->LocationRequest(emptyRecord);
+    EXPECT_EQ(1000, ability_->fixInterval_);
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] UpdateFixIntervalByRequest001 end");
+}
+
+HWTEST_F(GnssAbilityTest, RequestRecordBurstHdiCount001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssAbilityTest, RequestRecordBurstHdiCount001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] RequestRecordBurstHdiCount001 begin");
+    auto gnssAbility = GnssAbility::GetInstance();
+    sptr<GnssInterfaceTest> gnssInterface = new (std::nothrow) GnssInterfaceTest();
+    ASSERT_NE(nullptr, gnssInterface);
+    gnssAbility->gnssInterface_ = gnssInterface;
+    if (gnssAbility->gnssCallback_ == nullptr) {
+        gnssAbility->gnssCallback_ = new (std::nothrow) GnssEventCallback();
+    }
+    gnssAbility->gnssWorkingStatus_.store(GNSS_WORKING_STATUS_NONE);
+    gnssAbility->gnssBatchingWorkingStatus_.store(GNSS_BATCHING_WORKING_STATUS_NONE);
+
+    // a burst of app starts queues one full work record per start, only the latest one is applied
+    WorkRecord workRecord;
+    std::vector<AppExecFwk::InnerEvent::Pointer> events;
+    for (int i = 0; i < REQUEST_BURST_NUM; i++) {
+        AddBurstRequest(workRecord, i);
+        std::unique_ptr<WorkRecord> queuedRecord = std::make_unique<WorkRecord>();
+        queuedRecord->Set(workRecord);
+        int64_t requestSeq = ++gnssAbility->locationRequestSeq_;
+        events.push_back(AppExecFwk::InnerEvent::Get(
+            static_cast<uint32_t>(GnssInterfaceCode::SEND_LOCATION_REQUEST), queuedRecord, requestSeq));
+    }
+    auto gnssHandler = std::make_shared<GnssHandler>(AppExecFwk::EventRunner::Create(true));
+    for (auto& event : events) {
+        gnssHandler->HandleSendLocationRequest(event);
+    }
+    EXPECT_EQ(REQUEST_BURST_NUM, gnssAbility->GetRequestNum());
+    int enableGnssCount = gnssInterface->enableGnssCount_;
+    int startGnssCount = gnssInterface->startGnssCount_;
+    EXPECT_EQ(1, enableGnssCount);
+    EXPECT_EQ(1, startGnssCount);
+
+    // requests joining the running session one at a time do not reach the hdi
+    for (int i = REQUEST_BURST_NUM; i < 2 * REQUEST_BURST_NUM; i++) {
+        AddBurstRequest(workRecord, i);
+        gnssAbility->LocationRequest(workRecord);
+    }
+    EXPECT_EQ(2 * REQUEST_BURST_NUM, gnssAbility->GetRequestNum());
+    GTEST_LOG_(INFO) << 2 * REQUEST_BURST_NUM << " starts, hdi calls: enable " << gnssInterface->enableGnssCount_
+        << " start " << gnssInterface->startGnssCount_ << " config " << gnssInterface->setConfigParaCount_;
+    EXPECT_EQ(enableGnssCount, gnssInterface->enableGnssCount_);
+    EXPECT_EQ(startGnssCount, gnssInterface->startGnssCount_);
+    EXPECT_EQ(1, gnssInterface->setConfigParaCount_);
+
+    // the session stops once, when the last request leaves
+    WorkRecord emptyRecord;
+    gnssAbility->LocationRequest(emptyRecord);
+    EXPECT_EQ(startGnssCount, gnssInterface->stopGnssCount_);
+
+    // a record that fails to queue leaves the sequence alone, the one already queued is still applied
+    int64_t queuedSeq = gnssAbility->locationRequestSeq_.load();
+    auto savedHandler = ability_->gnssHandler_;
+    // a handler without a runner refuses every event
+    ability_->gnssHandler_ = std::make_shared<GnssHandler>(nullptr);
+    ability_->locationRequestSeq_.store(queuedSeq);
+    MessageParcel data;
+    MessageParcel reply;
+    workRecord.Marshalling(data);
+    ability_->SendMessage(static_cast<uint32_t>(GnssInterfaceCode::SEND_LOCATION_REQUEST), data, reply);
+    EXPECT_EQ(ERRCODE_SERVICE_UNAVAILABLE, reply.ReadInt32());
+    EXPECT_EQ(queuedSeq, ability_->locationRequestSeq_.load());
+    EXPECT_EQ(false, ability_->IsLocationRequestSuperseded(queuedSeq));
+    ability_->gnssHandler_ = savedHandler;
+
+    gnssAbility->ResetGnssInterface();
+    gnssAbility->gnssWorkingStatus_.store(GNSS_WORKING_STATUS_NONE);
+    gnssAbility->gnssBatchingWorkingStatus_.store(GNSS_BATCHING_WORKING_STATUS_NONE);
+    LBSLOGI(GNSS_TEST, "[GnssAbilityTest] RequestRecordBurstHdiCount001 end");
+}
 }  // namespace Location
 }  // namespace OHOS
-#endif // FEATURE_GNSS_SUPPORT
+#endif // FEATURE_GNSS_SUPPORT
\ No newline at end of file
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef FEATURE_GNSS_SUPPORT
+#include "gnss_inner_event_aggregator_test.h"
+
+#include "location_log.h"
+#include "location_log_event_ids.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Location {
+const int64_t AGGREGATOR_WINDOW_MS = 1000;
+const int64_t AGGREGATOR_RECEIVE_STEP_MS = 100;
+const int AGGREGATOR_RAW_SAMPLE_RATE = 3;
+const int AGGREGATOR_SAMPLED_FIX_NUM = 7;
+
+static LocationInfo BuildLocation(int64_t timeForFix, double accuracy)
+{
+    LocationInfo location;
+    location.timeForFix = timeForFix;
+    location.horizontalAccuracy = accuracy;
+    return location;
+}
+
+static SatelliteStatusInfo BuildSatelliteStatus(int satellitesNumber, int usedNumber)
+{
+    SatelliteStatusInfo info;
+    info.satellitesNumber = satellitesNumber;
+    for (int i = 0; i < satellitesNumber; i++) {
+        info.satelliteIds.push_back(i + 1);
+        info.constellation.push_back(static_cast<HDI::Location::Gnss::V2_0::ConstellationCategory>(1));
+        info.elevation.push_back(0);
+        info.azimuths.push_back(0);
+        info.carrierToNoiseDensitys.push_back(0);
+        info.carrierFrequencies.push_back(0);
+        info.additionalInfo.push_back(i < usedNumber ?
+            HDI::Location::Gnss::V2_0::SATELLITES_ADDITIONAL_INFO_USED_IN_FIX :
+            HDI::Location::Gnss::V2_0::SATELLITES_ADDITIONAL_INFO_EPHEMERIS_DATA_EXIST);
+    }
+    return info;
+}
+
+std::vector<CapturedInnerEvent> CapturingInnerEventAggregator::GetEvents(int event)
+{
+    std::vector<CapturedInnerEvent> matched;
+    for (auto& capturedEvent : events_) {
+        if (capturedEvent.event == event) {
+            matched.push_back(capturedEvent);
+        }
+    }
+    return matched;
+}
+
+void CapturingInnerEventAggregator::WriteInnerEvent(int event, std::vector<std::string>& names,
+    std::vector<std::string>& values)
+{
+    CapturedInnerEvent capturedEvent;
+    capturedEvent.event = event;
+    for (size_t i = 0; i < names.size() && i < values.size(); i++) {
+        capturedEvent.params[names[i]] = values[i];
+    }
+    events_.push_back(capturedEvent);
+}
+
+void GnssInnerEventAggregatorTest::SetUp()
+{
+}
+
+void GnssInnerEventAggregatorTest::TearDown()
+{
+}
+
+HWTEST_F(GnssInnerEventAggregatorTest, LocationWindowSummary001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssInnerEventAggregatorTest, LocationWindowSummary001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssInnerEventAggregatorTest] LocationWindowSummary001 begin");
+    CapturingInnerEventAggregator aggregator(AGGREGATOR_WINDOW_MS, 0);
+    std::vector<int64_t> fixTimes = {1000, 2000, 3000, 4500, 5500};
+    std::vector<double> accuracies = {3.0, 5.0, 4.0, 10.0, 8.0};
+    int64_t receiveTime = AGGREGATOR_RECEIVE_STEP_MS;
+    for (size_t i = 0; i < fixTimes.size(); i++) {
+        aggregator.OnLocation(BuildLocation(fixTimes[i], accuracies[i]), receiveTime);
+        receiveTime += AGGREGATOR_RECEIVE_STEP_MS;
+    }
+    // nothing is written until the window elapses
+    EXPECT_EQ(0, aggregator.events_.size());
+
+    aggregator.OnLocation(BuildLocation(6500, 6.0), AGGREGATOR_RECEIVE_STEP_MS + AGGREGATOR_WINDOW_MS);
+    auto summaries = aggregator.GetEvents(RECEIVE_GNSS_LOCATION_SUMMARY);
+    ASSERT_EQ(1, summaries.size());
+    EXPECT_EQ("5", summaries[0].params["count"]);
+    EXPECT_EQ(std::to_string(3.0), summaries[0].params["minAccuracy"]);
+    EXPECT_EQ(std::to_string(10.0), summaries[0].params["maxAccuracy"]);
+    EXPECT_EQ(std::to_string(6.0), summaries[0].params["meanAccuracy"]);
+    EXPECT_EQ("1000", summaries[0].params["minFixInterval"]);
+    EXPECT_EQ("1500", summaries[0].params["maxFixInterval"]);
+    EXPECT_EQ("1125", summaries[0].params["meanFixInterval"]);
+    EXPECT_EQ("500", summaries[0].params["fixIntervalJitter"]);
+
+    // the fix interval carries over into the next window, the session stop flushes it
+    aggregator.Flush();
+    summaries = aggregator.GetEvents(RECEIVE_GNSS_LOCATION_SUMMARY);
+    ASSERT_EQ(2, summaries.size());
+    EXPECT_EQ("1", summaries[1].params["count"]);
+    EXPECT_EQ("1000", summaries[1].params["minFixInterval"]);
+    EXPECT_EQ(0, aggregator.GetEvents(RECEIVE_GNSS_LOCATION).size());
+    LBSLOGI(GNSS_TEST, "[GnssInnerEventAggregatorTest] LocationWindowSummary001 end");
+}
+
+HWTEST_F(GnssInnerEventAggregatorTest, SatelliteWindowSummary001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssInnerEventAggregatorTest, SatelliteWindowSummary001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssInnerEventAggregatorTest] SatelliteWindowSummary001 begin");
+    CapturingInnerEventAggregator aggregator(AGGREGATOR_WINDOW_MS, 0);
+    aggregator.OnSatelliteStatus(BuildSatelliteStatus(4, 2), AGGREGATOR_RECEIVE_STEP_MS);
+    aggregator.OnSatelliteStatus(BuildSatelliteStatus(6, 3), AGGREGATOR_RECEIVE_STEP_MS * 2);
+    aggregator.OnSatelliteStatus(BuildSatelliteStatus(8, 4), AGGREGATOR_RECEIVE_STEP_MS * 3);
+    EXPECT_EQ(0, aggregator.events_.size());
+
+    aggregator.Flush();
+    auto summaries = aggregator.GetEvents(RECEIVE_SATELLITESTATUSINFO_SUMMARY);
+    ASSERT_EQ(1, summaries.size());
+    EXPECT_EQ("3", summaries[0].params["count"]);
+    EXPECT_EQ("6", summaries[0].params["meanSatellites"]);
+    EXPECT_EQ("8", summaries[0].params["maxSatellites"]);
+    EXPECT_EQ("3", summaries[0].params["meanUsedSatellites"]);
+    EXPECT_EQ("2", summaries[0].params["minUsedSatellites"]);
+    EXPECT_EQ("4", summaries[0].params["maxUsedSatellites"]);
+    // no location was reported, so there is no location summary
+    EXPECT_EQ(0, aggregator.GetEvents(RECEIVE_GNSS_LOCATION_SUMMARY).size());
+
+    // an empty window writes nothing
+    aggregator.Flush();
+    EXPECT_EQ(1, aggregator.events_.size());
+    LBSLOGI(GNSS_TEST, "[GnssInnerEventAggregatorTest] SatelliteWindowSummary001 end");
+}
+
+HWTEST_F(GnssInnerEventAggregatorTest, RawEventSampling001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssInnerEventAggregatorTest, RawEventSampling001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssInnerEventAggregatorTest] RawEventSampling001 begin");
+    CapturingInnerEventAggregator aggregator(AGGREGATOR_WINDOW_MS, AGGREGATOR_RAW_SAMPLE_RATE);
+    for (int i = 0; i < AGGREGATOR_SAMPLED_FIX_NUM; i++) {
+        aggregator.OnLocation(BuildLocation((i + 1) * MILLI_PER_SEC, 1.0), AGGREGATOR_RECEIVE_STEP_MS);
+        aggregator.OnSatelliteStatus(BuildSatelliteStatus(1, 1), AGGREGATOR_RECEIVE_STEP_MS);
+    }
+    // reports 0, 3 and 6 are sampled
+    auto rawLocations = aggregator.GetEvents(RECEIVE_GNSS_LOCATION);
+    ASSERT_EQ(3, rawLocations.size());
+    EXPECT_EQ("1", rawLocations[0].params["locationTimestamp"]);
+    EXPECT_EQ("4", rawLocations[1].params["locationTimestamp"]);
+    EXPECT_EQ(3, aggregator.GetEvents(RECEIVE_SATELLITESTATUSINFO).size());
+
+    CapturingInnerEventAggregator unsampledAggregator(AGGREGATOR_WINDOW_MS, 0);
+    for (int i = 0; i < AGGREGATOR_SAMPLED_FIX_NUM; i++) {
+        unsampledAggregator.OnLocation(BuildLocation((i + 1) * MILLI_PER_SEC, 1.0), AGGREGATOR_RECEIVE_STEP_MS);
+    }
+    EXPECT_EQ(0, unsampledAggregator.events_.size());
+    LBSLOGI(GNSS_TEST, "[GnssInnerEventAggregatorTest] RawEventSampling001 end");
+}
+
+HWTEST_F(GnssInnerEventAggregatorTest, FlushResetsSession001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "GnssInnerEventAggregatorTest, FlushResetsSession001, TestSize.Level1";
+    LBSLOGI(GNSS_TEST, "[GnssInnerEventAggregatorTest] FlushResetsSession001 begin");
+    CapturingInnerEventAggregator aggregator(AGGREGATOR_WINDOW_MS, 0);
+    aggregator.OnLocation(BuildLocation(1000, 1.0), AGGREGATOR_RECEIVE_STEP_MS);
+    aggregator.OnLocation(BuildLocation(2000, 1.0), AGGREGATOR_RECEIVE_STEP_MS * 2);
+    aggregator.Flush();
+    // a fix of the next session does not produce an interval against the previous session
+    aggregator.OnLocation(BuildLocation(60000, 1.0), AGGREGATOR_RECEIVE_STEP_MS * 3);
+    aggregator.Flush();
+    auto summaries = aggregator.GetEvents(RECEIVE_GNSS_LOCATION_SUMMARY);
+    ASSERT_EQ(2, summaries.size());
+    EXPECT_EQ("1000", summaries[0].params["maxFixInterval"]);
+    EXPECT_EQ("1", summaries[1].params["count"]);
+    EXPECT_EQ("0", summaries[1].params["maxFixInterval"]);
+    LBSLOGI(GNSS_TEST, "[GnssInnerEventAggregatorTest] FlushResetsSession001 end");
+}
+}  // namespace Location
+}  // namespace OHOS
+#endif // FEATURE_GNSS_SUPPORT
@@ -31,26 +31,32 @@ GnssInterfaceTest::~GnssInterfaceTest()
 
 int32_t GnssInterfaceTest::SetGnssConfigPara(const GnssConfigPara &para)
 {
+    configPara_ = para;
+    setConfigParaCount_++;
     return HDF_SUCCESS;
 }
 
 int32_t GnssInterfaceTest::EnableGnss(const sptr<IGnssCallback> &callbackObj)
 {
+    enableGnssCount_++;
     return HDF_SUCCESS;
 }
 
 int32_t GnssInterfaceTest::DisableGnss()
 {
+    disableGnssCount_++;
     return HDF_SUCCESS;
 }
 
 int32_t GnssInterfaceTest::StartGnss(HDI::Location::Gnss::V2_0::GnssStartType type)
 {
+    startGnssCount_++;
     return HDF_SUCCESS;
 }
 
 int32_t GnssInterfaceTest::StopGnss(HDI::Location::Gnss::V2_0::GnssStartType type)
 {
+    stopGnssCount_++;
     return HDF_SUCCESS;
 }
 
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REQUEST_DEADLINE_QUEUE_TEST_H
+#define REQUEST_DEADLINE_QUEUE_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "request_deadline_queue.h"
+
+namespace OHOS {
+namespace Location {
+class RequestDeadlineQueueTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+    std::shared_ptr<Request> MockSingleShotRequest(int timeOut);
+};
+} // namespace Location
+} // namespace OHOS
+#endif // REQUEST_DEADLINE_QUEUE_TEST_H
@@ -667,7 +667,7 @@ HWTEST_F(LocatorImplTest, locatorImplIsLocationCallbackRegistered002, TestSize.L
         << "LocatorImplTest, locatorImplIsLocationCallbackRegistered002, TestSize.Level1";
     LBSLOGI(LOCATOR, "[LocatorImplTest] locatorImplIsLocationCallbackRegistered002 begin");
     sptr<IRemoteObject> callback;
-    locatorImpl_->AddSatelliteStatusChangeCallBack(callback);
+    locatorImpl_->AddSatelliteStatusChangeCallBack(callback, 0);
     locatorImpl_->IsSatelliteStatusChangeCallbackRegistered(callback);
     LBSLOGI(LOCATOR, "[LocatorImplTest] locatorImplIsLocationCallbackRegistered002 end");
 }
@@ -678,7 +678,7 @@ HWTEST_F(LocatorImplTest, locatorImplIsNmeaCallbackRegistered001, TestSize.Level
         << "LocatorImplTest, locatorImplIsNmeaCallbackRegistered001, TestSize.Level1";
     LBSLOGI(LOCATOR, "[LocatorImplTest] locatorImplIsNmeaCallbackRegistered001 begin");
     sptr<IRemoteObject> callback;
-    locatorImpl_->AddNmeaCallBack(callback);
+    locatorImpl_->AddNmeaCallBack(callback, 0);
     locatorImpl_->IsNmeaCallbackRegistered(callback);
     LBSLOGI(LOCATOR, "[LocatorImplTest] locatorImplIsNmeaCallbackRegistered001 end");
 }
@@ -708,7 +708,7 @@ HWTEST_F(LocatorImplTest, locatorImplResumeGnssStatusCallback001, TestSize.Level
         << "LocatorImplTest, locatorImplResumeGnssStatusCallback001, TestSize.Level1";
     LBSLOGI(LOCATOR, "[LocatorImplTest] locatorImplResumeGnssStatusCallback001 begin");
     sptr<IRemoteObject> callback;
-    locatorImpl_->AddSatelliteStatusChangeCallBack(callback);
+    locatorImpl_->AddSatelliteStatusChangeCallBack(callback, 0);
     std::shared_ptr<CallbackResumeManager> callbackResumer = std::make_shared<CallbackResumeManager>();
     callbackResumer->ResumeCallback();
     LBSLOGI(LOCATOR, "[LocatorImplTest] locatorImplResumeGnssStatusCallback001 end");
@@ -720,7 +720,7 @@ HWTEST_F(LocatorImplTest, locatorImplResumeNmeaMessageCallback001, TestSize.Leve
         << "LocatorImplTest, locatorImplResumeNmeaMessageCallback001, TestSize.Level1";
     LBSLOGI(LOCATOR, "[LocatorImplTest] locatorImplResumeNmeaMessageCallback001 begin");
     sptr<IRemoteObject> callback;
-    locatorImpl_->AddNmeaCallBack(callback);
+    locatorImpl_->AddNmeaCallBack(callback, 0);
     std::shared_ptr<CallbackResumeManager> callbackResumer = std::make_shared<CallbackResumeManager>();
     callbackResumer->ResumeCallback();
     LBSLOGI(LOCATOR, "[LocatorImplTest] locatorImplResumeNmeaMessageCallback001 end");
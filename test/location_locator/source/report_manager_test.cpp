@@ -15,6 +15,10 @@
 
 #include "report_manager_test.h"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "accesstoken_kit.h"
 #include "message_parcel.h"
 #include "nativetoken_kit.h"
@@ -24,6 +28,7 @@
 #include "location.h"
 #include "locator.h"
 #define private public
+#include "location_account_manager.h"
 #include "locator_ability.h"
 #include "request.h"
 #undef private
@@ -37,6 +42,11 @@ namespace OHOS {
 namespace Location {
 const int32_t LOCATION_PERM_NUM = 5;
 const std::string UNKNOWN_ABILITY = "unknown_ability";
+const int FAN_OUT_SUBSCRIBER_NUM = 200;
+const int FAN_OUT_FIX_NUM = 20;
+const int CACHE_STRESS_READER_NUM = 4;
+const int CACHE_STRESS_UPDATE_NUM = 2000;
+const int LAST_LOCATION_USER_NUM = 4;
 void ReportManagerTest::SetUp()
 {
     MockNativePermission();
@@ -654,5 +664,181 @@ HWTEST_F(ReportManagerTest, IsCacheGnssLocationValid001, TestSize.Level1)
     reportManager_->IsCacheGnssLocationValid();
     LBSLOGI(REPORT_MANAGER, "[ReportManagerTest] IsCacheGnssLocationValid001 end");
 }
+
+HWTEST_F(ReportManagerTest, OnReportLocationFanOutBenchmark001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "ReportManagerTest, OnReportLocationFanOutBenchmark001, TestSize.Level1";
+    LBSLOGI(REPORT_MANAGER, "[ReportManagerTest] OnReportLocationFanOutBenchmark001 begin");
+    std::list<std::shared_ptr<Request>> gnssList;
+    for (int i = 0; i < FAN_OUT_SUBSCRIBER_NUM; i++) {
+        std::shared_ptr<Request> request = std::make_shared<Request>();
+        std::unique_ptr<RequestConfig> requestConfig = std::make_unique<RequestConfig>();
+        requestConfig->SetScenario(SCENE_DAILY_LIFE_SERVICE);
+        requestConfig->SetFixNumber(0);
+        requestConfig->SetTimeInterval(0);
+        request->SetUid(1000);
+        request->SetPid(i + 1);
+        request->SetTokenId(tokenId_);
+        request->SetFirstTokenId(0);
+        request->SetPackageName("ReportManagerTest");
+        request->SetRequestConfig(*requestConfig);
+        request->SetRequesting(true);
+        request->SetUuid(std::to_string(i));
+        request->SetLocatorCallBack(sptr<ILocatorCallback>(new (std::nothrow) LocatorCallbackNapi()));
+        gnssList.push_back(request);
+    }
+    auto locatorAbility = LocatorAbility::GetInstance();
+    auto oldGnssList = (*locatorAbility->requests_)[GNSS_ABILITY];
+    (*locatorAbility->requests_)[GNSS_ABILITY] = gnssList;
+    auto location = MockLocation();
+    location->SetIsFromMock(0);
+    location->SetLocationSourceType(GNSS_TYPE);
+
+    // every fix pays the full authorization checks
+    uint64_t hitCount = reportManager_->authSnapshotHitCount_.load();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < FAN_OUT_FIX_NUM; i++) {
+        reportManager_->InvalidateAuthSnapshot();
+        location->SetTimeSinceBoot(CommonUtils::GetSinceBootTime());
+        reportManager_->OnReportLocation(location, GNSS_ABILITY);
+    }
+    auto uncachedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(hitCount, reportManager_->authSnapshotHitCount_.load());
+
+    // the switch state of the test environment decides whether the first fix could cache, so seed the snapshots
+    for (auto& request : gnssList) {
+        request->SetAuthSnapshot(reportManager_->authSnapshotGeneration_.load(), PERMISSION_ACCURATE, false);
+    }
+    hitCount = reportManager_->authSnapshotHitCount_.load();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < FAN_OUT_FIX_NUM; i++) {
+        location->SetTimeSinceBoot(CommonUtils::GetSinceBootTime());
+        reportManager_->OnReportLocation(location, GNSS_ABILITY);
+    }
+    auto cachedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    // every subscriber of every fix is authorized from its snapshot
+    EXPECT_EQ(hitCount + FAN_OUT_SUBSCRIBER_NUM * FAN_OUT_FIX_NUM, reportManager_->authSnapshotHitCount_.load());
+    GTEST_LOG_(INFO) << "fan-out to " << FAN_OUT_SUBSCRIBER_NUM << " subscribers, per fix: uncached "
+        << uncachedUs / FAN_OUT_FIX_NUM << "us, cached " << cachedUs / FAN_OUT_FIX_NUM << "us";
+
+    int permissionLevel = PERMISSION_INVALID;
+    bool isSystemApp = false;
+    gnssList.front()->SetAuthSnapshot(reportManager_->authSnapshotGeneration_.load(), PERMISSION_ACCURATE, true);
+    EXPECT_EQ(true, gnssList.front()->GetAuthSnapshot(reportManager_->authSnapshotGeneration_.load(),
+        permissionLevel, isSystemApp));
+    EXPECT_EQ(PERMISSION_ACCURATE, permissionLevel);
+    reportManager_->InvalidateAuthSnapshot();
+    EXPECT_EQ(false, gnssList.front()->GetAuthSnapshot(reportManager_->authSnapshotGeneration_.load(),
+        permissionLevel, isSystemApp));
+    (*locatorAbility->requests_)[GNSS_ABILITY] = oldGnssList;
+    LBSLOGI(REPORT_MANAGER, "[ReportManagerTest] OnReportLocationFanOutBenchmark001 end");
+}
+
+HWTEST_F(ReportManagerTest, CacheLocationSnapshotStress001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "ReportManagerTest, CacheLocationSnapshotStress001, TestSize.Level1";
+    LBSLOGI(REPORT_MANAGER, "[ReportManagerTest] CacheLocationSnapshotStress001 begin");
+    std::atomic<bool> stop(false);
+    std::atomic<int> tornCount(0);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < CACHE_STRESS_READER_NUM; i++) {
+        readers.emplace_back([this, &stop, &tornCount]() {
+            while (!stop.load()) {
+                auto gnss = reportManager_->GetCacheGnssLocation();
+                auto nlp = reportManager_->GetCacheNlpLocation();
+                // every published snapshot is written with latitude == longitude
+                if (gnss == nullptr || nlp == nullptr ||
+                    !CommonUtils::DoubleEqual(gnss->GetLatitude(), gnss->GetLongitude()) ||
+                    !CommonUtils::DoubleEqual(nlp->GetLatitude(), nlp->GetLongitude()) ||
+                    nlp->GetLocationSourceType() == LocationSourceType::INDOOR_TYPE) {
+                    tornCount++;
+                }
+                reportManager_->IsCacheGnssLocationValid();
+            }
+        });
+    }
+    Location location;
+    location.SetTimeStamp(CommonUtils::GetCurrentTimeStamp() * MILLI_PER_SEC);
+    for (int i = 0; i < CACHE_STRESS_UPDATE_NUM; i++) {
+        double value = static_cast<double>(i % 90);
+        location.SetLatitude(value);
+        location.SetLongitude(value);
+        location.SetTimeSinceBoot(CommonUtils::GetSinceBootTime());
+        location.SetLocationSourceType(i % 2 == 0 ? LocationSourceType::INDOOR_TYPE :
+            LocationSourceType::NETWORK_TYPE);
+        reportManager_->UpdateCacheGnssLocation(location);
+        reportManager_->UpdateCacheNlpLocation(location);
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(0, tornCount.load());
+    EXPECT_EQ(true, reportManager_->IsCacheGnssLocationValid());
+    auto snapshot = reportManager_->GetCacheGnssLocation();
+    EXPECT_EQ(snapshot.get(), reportManager_->GetCacheGnssLocation().get());
+    LBSLOGI(REPORT_MANAGER, "[ReportManagerTest] CacheLocationSnapshotStress001 end");
+}
+
+HWTEST_F(ReportManagerTest, LastLocationCopyOnWrite001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "ReportManagerTest, LastLocationCopyOnWrite001, TestSize.Level1";
+    LBSLOGI(REPORT_MANAGER, "[ReportManagerTest] LastLocationCopyOnWrite001 begin");
+    auto accountManager = LocationAccountManager::GetInstance();
+    auto oldActiveIds = accountManager->GetActiveUserIds();
+    std::vector<int> activeIds;
+    for (int i = 0; i < LAST_LOCATION_USER_NUM; i++) {
+        activeIds.push_back(100 + i);
+    }
+    {
+        std::unique_lock<std::mutex> lock(LocationAccountManager::accountMutex_);
+        accountManager->activeIds_ = activeIds;
+    }
+    std::atomic<bool> stop(false);
+    std::atomic<int> tornCount(0);
+    std::thread reader([this, &stop, &tornCount]() {
+        while (!stop.load()) {
+            auto lastLocation = reportManager_->GetLastLocationByUserId(100);
+            if (lastLocation != nullptr &&
+                !CommonUtils::DoubleEqual(lastLocation->GetLatitude(), lastLocation->GetLongitude())) {
+                tornCount++;
+            }
+        }
+    });
+    auto location = MockLocation();
+    for (int i = 0; i < CACHE_STRESS_UPDATE_NUM; i++) {
+        double value = static_cast<double>(i % 90);
+        location->SetLatitude(value);
+        location->SetLongitude(value);
+        reportManager_->UpdateLastLocation(location);
+    }
+    stop = true;
+    reader.join();
+    EXPECT_EQ(0, tornCount.load());
+
+    // all active users reference the same immutable location
+    auto lastLocationsMap = std::atomic_load(&reportManager_->lastLocationsMap_);
+    auto first = lastLocationsMap->find(activeIds.front());
+    ASSERT_NE(lastLocationsMap->end(), first);
+    for (int userId : activeIds) {
+        auto iter = lastLocationsMap->find(userId);
+        ASSERT_NE(lastLocationsMap->end(), iter);
+        EXPECT_EQ(first->second.get(), iter->second.get());
+    }
+    // a published map is never modified in place
+    reportManager_->UpdateLastLocation(location);
+    EXPECT_NE(lastLocationsMap.get(), std::atomic_load(&reportManager_->lastLocationsMap_).get());
+    EXPECT_EQ(first->second.get(), lastLocationsMap->find(activeIds.front())->second.get());
+    {
+        std::unique_lock<std::mutex> lock(LocationAccountManager::accountMutex_);
+        accountManager->activeIds_ = oldActiveIds;
+    }
+    LBSLOGI(REPORT_MANAGER, "[ReportManagerTest] LastLocationCopyOnWrite001 end");
+}
 }  // namespace Location
-}  // namespace OHOS
\ No newline at end of file
+}  // namespace OHOS
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "request_deadline_queue_test.h"
+
+#include <chrono>
+#include <list>
+
+#include "common_utils.h"
+#include "location_log.h"
+#include "request_config.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace Location {
+const int DEADLINE_STRESS_REQUEST_NUM = 5000;
+const int DEADLINE_STRESS_TICK_MS = 10;
+const int DEADLINE_STRESS_MAX_TIMEOUT_MS = 30000;
+
+void RequestDeadlineQueueTest::SetUp()
+{
+}
+
+void RequestDeadlineQueueTest::TearDown()
+{
+}
+
+std::shared_ptr<Request> RequestDeadlineQueueTest::MockSingleShotRequest(int timeOut)
+{
+    std::shared_ptr<Request> request = std::make_shared<Request>();
+    std::unique_ptr<RequestConfig> requestConfig = std::make_unique<RequestConfig>();
+    requestConfig->SetFixNumber(1);
+    requestConfig->SetTimeOut(timeOut);
+    requestConfig->SetTimeStamp(0);
+    request->SetRequestConfig(*requestConfig);
+    request->SetRequesting(true);
+    return request;
+}
+
+HWTEST_F(RequestDeadlineQueueTest, RequestDeadlineQueue001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "RequestDeadlineQueueTest, RequestDeadlineQueue001, TestSize.Level1";
+    LBSLOGI(REQUEST_MANAGER, "[RequestDeadlineQueueTest] RequestDeadlineQueue001 begin");
+    RequestDeadlineQueue queue;
+    auto first = MockSingleShotRequest(1000);
+    auto second = MockSingleShotRequest(2000);
+    EXPECT_EQ(INVALID_REQUEST_DEADLINE, queue.GetNextDeadline());
+    EXPECT_EQ(true, queue.Push(second, 2000));
+    EXPECT_EQ(true, queue.Push(first, 1000)); // new earliest deadline
+    EXPECT_EQ(false, queue.Push(second, 3000)); // moved, the earliest one is unchanged
+    EXPECT_EQ(2, static_cast<int>(queue.Size()));
+    EXPECT_EQ(1000, queue.GetNextDeadline());
+
+    EXPECT_EQ(true, queue.Remove(first));
+    EXPECT_EQ(false, queue.Remove(first));
+    EXPECT_EQ(3000, queue.GetNextDeadline());
+
+    EXPECT_EQ(0, static_cast<int>(queue.PopExpired(2999).size()));
+    auto expired = queue.PopExpired(3000);
+    ASSERT_EQ(1, static_cast<int>(expired.size()));
+    EXPECT_EQ(second, expired.front());
+    EXPECT_EQ(0, static_cast<int>(queue.Size()));
+    EXPECT_EQ(false, queue.Remove(nullptr));
+    EXPECT_EQ(false, queue.Push(nullptr, 0));
+    LBSLOGI(REQUEST_MANAGER, "[RequestDeadlineQueueTest] RequestDeadlineQueue001 end");
+}
+
+HWTEST_F(RequestDeadlineQueueTest, RequestDeadlineQueueStress001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "RequestDeadlineQueueTest, RequestDeadlineQueueStress001, TestSize.Level1";
+    LBSLOGI(REQUEST_MANAGER, "[RequestDeadlineQueueTest] RequestDeadlineQueueStress001 begin");
+    RequestDeadlineQueue queue;
+    std::list<std::shared_ptr<Request>> requests;
+    for (int i = 0; i < DEADLINE_STRESS_REQUEST_NUM; i++) {
+        // mixed timeouts spread over the whole window
+        int timeOut = (i * 7919) % DEADLINE_STRESS_MAX_TIMEOUT_MS + 1;
+        auto request = MockSingleShotRequest(timeOut);
+        requests.push_back(request);
+        queue.Push(request, timeOut);
+    }
+    // requests stopped before their timeout leave the queue right away
+    int removedNum = 0;
+    for (auto iter = requests.begin(); iter != requests.end(); ++iter) {
+        if ((removedNum++ % 10) == 0) {
+            EXPECT_EQ(true, queue.Remove(*iter));
+        }
+    }
+    int expectedNum = static_cast<int>(queue.Size());
+
+    int expiredNum = 0;
+    int lateNum = 0;
+    int64_t lastTick = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int64_t now = 0; now <= DEADLINE_STRESS_MAX_TIMEOUT_MS; now += DEADLINE_STRESS_TICK_MS) {
+        for (auto& request : queue.PopExpired(now)) {
+            int64_t deadline = request->GetRequestConfig()->GetTimeOut();
+            // each request expires in the first tick at or after its deadline
+            if (deadline > now || deadline <= lastTick - DEADLINE_STRESS_TICK_MS) {
+                lateNum++;
+            }
+            expiredNum++;
+        }
+        lastTick = now + DEADLINE_STRESS_TICK_MS;
+    }
+    auto queueUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    // the same ticks with a full scan of the request list, as IsRequestAvailable did on every pass
+    int scannedNum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int64_t now = 0; now <= DEADLINE_STRESS_MAX_TIMEOUT_MS; now += DEADLINE_STRESS_TICK_MS) {
+        for (auto& request : requests) {
+            if (request->GetRequestConfig()->GetTimeOut() <= now) {
+                scannedNum++;
+            }
+        }
+    }
+    auto scanUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    GTEST_LOG_(INFO) << DEADLINE_STRESS_REQUEST_NUM << " requests, deadline queue " << queueUs
+        << "us, full scan " << scanUs << "us, scan hits " << scannedNum;
+
+    EXPECT_EQ(expectedNum, expiredNum);
+    EXPECT_EQ(0, lateNum);
+    EXPECT_EQ(0, static_cast<int>(queue.Size()));
+    EXPECT_EQ(INVALID_REQUEST_DEADLINE, queue.GetNextDeadline());
+    LBSLOGI(REQUEST_MANAGER, "[RequestDeadlineQueueTest] RequestDeadlineQueueStress001 end");
+}
+} // namespace Location
+} // namespace OHOS
@@ -35,6 +35,8 @@ public:
     void MockNativePermission();
     void FillRequestField(std::shared_ptr<Request>& request);
     void VerifyRequestField(std::shared_ptr<Request>& request);
+    std::shared_ptr<Request> CreateChurnRequest();
+    int64_t HandleRequestChurn(std::list<std::shared_ptr<Request>>& list, bool isIncremental);
 
     RequestManager* requestManager_;
     std::shared_ptr<Request> request_;
@@ -252,7 +252,7 @@ HWTEST_F(LocatorAbilityTest, LocatorAbilityApplyRequestsTest001, TestSize.Level1
         << "LocatorAbilityTest, LocatorAbilityApplyRequestsTest001, TestSize.Level1";
     LBSLOGI(LOCATOR, "[LocatorAbilityTest] LocatorAbilityApplyRequestsTest001 begin");
     int delay = 1;
-    locatorAbility->ApplyRequests(delay);
+    locatorAbility->ApplyRequests(delay, false);
     LBSLOGI(LOCATOR, "[LocatorAbilityTest] LocatorAbilityApplyRequestsTest001 end");
 }
 
@@ -15,6 +15,8 @@
 
 #include "request_manager_test.h"
 
+#include <chrono>
+
 #include "accesstoken_kit.h"
 #include "app_mgr_constants.h"
 #include "nativetoken_kit.h"
@@ -37,6 +39,8 @@ namespace Location {
 const int32_t LOCATION_PERM_NUM = 5;
 const int UNKNOWN_PRIORITY = 0x01FF;
 const int UNKNOWN_SCENE = 0x02FF;
+const int CHURN_REQUEST_NUM = 500;
+const int CHURN_ROUND_NUM = 50;
 void RequestManagerTest::SetUp()
 {
     MockNativePermission();
@@ -767,6 +771,161 @@ HWTEST_F(RequestManagerTest, RegisterLocationErrorCallback_001, TestSize.Level1)
     LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] RegisterLocationErrorCallback_001 end");
 }
 
+std::shared_ptr<Request> RequestManagerTest::CreateChurnRequest()
+{
+    auto request = std::make_shared<Request>();
+    request->SetUid(SYSTEM_UID);
+    request->SetPid(0);
+    request->SetTokenId(tokenId_);
+    request->SetFirstTokenId(0);
+    request->SetPackageName("RequestManagerTest");
+    request->SetRequesting(true);
+    auto requestConfig = std::make_unique<RequestConfig>();
+    requestConfig->SetPriority(PRIORITY_FAST_FIRST_FIX);
+    requestConfig->SetFixNumber(0);
+    request->SetRequestConfig(*requestConfig);
+    return request;
+}
+
+int64_t RequestManagerTest::HandleRequestChurn(std::list<std::shared_ptr<Request>>& list, bool isIncremental)
+{
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < CHURN_ROUND_NUM; i++) {
+        // one request stops and another one starts, the others stay unchanged
+        list.pop_front();
+        list.push_back(CreateChurnRequest());
+        if (!isIncremental) {
+            requestManager_->InvalidateWorkRecord();
+        }
+        requestManager_->HandleRequest(GNSS_ABILITY, list);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() / CHURN_ROUND_NUM;
+}
+
+HWTEST_F(RequestManagerTest, HandleRequestChurn001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "RequestManagerTest, HandleRequestChurn001, TestSize.Level1";
+    LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] HandleRequestChurn001 begin");
+    std::list<std::shared_ptr<Request>> list;
+    for (int i = 0; i < CHURN_REQUEST_NUM; i++) {
+        list.push_back(CreateChurnRequest());
+    }
+    requestManager_->InvalidateWorkRecord();
+    requestManager_->HandleRequest(GNSS_ABILITY, list);
+
+    int64_t fullCost = HandleRequestChurn(list, false);
+    int64_t incrementalCost = HandleRequestChurn(list, true);
+    LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] %{public}d requests, full: %{public}s us, "
+        "incremental: %{public}s us per HandleRequest", CHURN_REQUEST_NUM,
+        std::to_string(fullCost).c_str(), std::to_string(incrementalCost).c_str());
+    GTEST_LOG_(INFO) << "full: " << fullCost << " us, incremental: " << incrementalCost << " us";
+
+    // every request in the list is evaluated once under the current generation, removed ones are dropped
+    auto& evaluationMap = requestManager_->workRecordEvaluationMap_[GNSS_ABILITY];
+    EXPECT_EQ(list.size(), evaluationMap.size());
+    auto changedRequest = list.front();
+    requestManager_->InvalidateWorkRecord(changedRequest);
+    EXPECT_EQ(evaluationMap.end(), evaluationMap.find(changedRequest));
+    requestManager_->InvalidateWorkRecord();
+    EXPECT_FALSE(requestManager_->IsEvaluationReusable(list.back(), evaluationMap,
+        requestManager_->workRecordGeneration_.load()));
+
+    list.clear();
+    requestManager_->HandleRequest(GNSS_ABILITY, list);
+    EXPECT_EQ(0, requestManager_->workRecordEvaluationMap_[GNSS_ABILITY].size());
+    LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] HandleRequestChurn001 end");
+}
+
+HWTEST_F(RequestManagerTest, HandleRequestRejectedEvaluation001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "RequestManagerTest, HandleRequestRejectedEvaluation001, TestSize.Level1";
+    LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] HandleRequestRejectedEvaluation001 begin");
+    auto request = CreateChurnRequest();
+    uint64_t generation = requestManager_->workRecordGeneration_.load();
+    std::map<std::shared_ptr<Request>, std::pair<uint64_t, bool>> evaluationMap;
+    // a rejection is evaluated again, the app may have come to foreground since
+    evaluationMap[request] = std::make_pair(generation, false);
+    EXPECT_FALSE(requestManager_->IsEvaluationReusable(request, evaluationMap, generation));
+    evaluationMap[request] = std::make_pair(generation, true);
+    EXPECT_TRUE(requestManager_->IsEvaluationReusable(request, evaluationMap, generation));
+
+    // a foreground/background change of the app drops the verdicts of its requests
+    requestManager_->workRecordEvaluationMap_[GNSS_ABILITY] = evaluationMap;
+    requestManager_->HandlePowerSuspendChanged(0, SYSTEM_UID + 1, 0);
+    EXPECT_EQ(1, requestManager_->workRecordEvaluationMap_[GNSS_ABILITY].size());
+    requestManager_->HandlePowerSuspendChanged(0, SYSTEM_UID, 0);
+    EXPECT_EQ(0, requestManager_->workRecordEvaluationMap_[GNSS_ABILITY].size());
+    LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] HandleRequestRejectedEvaluation001 end");
+}
+
+HWTEST_F(RequestManagerTest, HandleRequestSingleFixDone001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "RequestManagerTest, HandleRequestSingleFixDone001, TestSize.Level1";
+    LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] HandleRequestSingleFixDone001 begin");
+    std::list<std::shared_ptr<Request>> list;
+    for (int i = 0; i < CHURN_ROUND_NUM; i++) {
+        list.push_back(CreateChurnRequest());
+    }
+    // the requests were granted under the current generation
+    uint64_t generation = requestManager_->workRecordGeneration_.load();
+    for (auto& request : list) {
+        requestManager_->workRecordEvaluationMap_[GNSS_ABILITY][request] = std::make_pair(generation, true);
+    }
+
+    // a single fix request is done, report manager applies the requests without a global change
+    auto singleFixRequest = list.front();
+    singleFixRequest->SetRequesting(false);
+    list.pop_front();
+    std::shared_ptr<AppExecFwk::EventRunner> runner;
+    auto locatorHandler = std::make_shared<LocatorHandler>(runner);
+    AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(0, static_cast<int64_t>(false));
+    locatorHandler->ApplyRequirementsEvent(event);
+    EXPECT_EQ(generation, requestManager_->workRecordGeneration_.load());
+    requestManager_->HandleRequest(GNSS_ABILITY, list);
+    auto& evaluationMap = requestManager_->workRecordEvaluationMap_[GNSS_ABILITY];
+    EXPECT_EQ(list.size(), evaluationMap.size());
+    for (auto& request : list) {
+        EXPECT_TRUE(requestManager_->IsEvaluationReusable(request, evaluationMap, generation));
+    }
+
+    // a global change evaluates every request again
+    event = AppExecFwk::InnerEvent::Get(0, static_cast<int64_t>(true));
+    locatorHandler->ApplyRequirementsEvent(event);
+    EXPECT_EQ(generation + 1, requestManager_->workRecordGeneration_.load());
+    EXPECT_FALSE(requestManager_->IsEvaluationReusable(list.front(), evaluationMap,
+        requestManager_->workRecordGeneration_.load()));
+    list.clear();
+    requestManager_->HandleRequest(GNSS_ABILITY, list);
+    LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] HandleRequestSingleFixDone001 end");
+}
+
+HWTEST_F(RequestManagerTest, HandleRequestDeadline001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "RequestManagerTest, HandleRequestDeadline001, TestSize.Level1";
+    LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] HandleRequestDeadline001 begin");
+    auto expiredRequest = CreateChurnRequest();
+    auto requestConfig = std::make_unique<RequestConfig>();
+    requestConfig->SetFixNumber(1);
+    requestConfig->SetTimeOut(0);
+    requestConfig->SetTimeStamp(0); // long ago
+    expiredRequest->SetRequestConfig(*requestConfig);
+    auto continuousRequest = CreateChurnRequest();
+    requestManager_->AddRequestDeadline(expiredRequest);
+    requestManager_->AddRequestDeadline(continuousRequest);
+    EXPECT_EQ(1, requestManager_->requestDeadlineQueue_.Size());
+
+    requestManager_->HandleRequestDeadline();
+    EXPECT_EQ(false, expiredRequest->GetIsRequesting());
+    EXPECT_EQ(true, continuousRequest->GetIsRequesting());
+    EXPECT_EQ(0, requestManager_->requestDeadlineQueue_.Size());
+    LBSLOGI(REQUEST_MANAGER, "[RequestManagerTest] HandleRequestDeadline001 end");
+}
+
 HWTEST_F(RequestManagerTest, Template_001, TestSize.Level1)
 {
     GTEST_LOG_(INFO)
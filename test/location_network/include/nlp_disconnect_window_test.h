@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NLP_DISCONNECT_WINDOW_TEST_H
+#define NLP_DISCONNECT_WINDOW_TEST_H
+#ifdef FEATURE_NETWORK_SUPPORT
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "nlp_disconnect_window.h"
+
+namespace OHOS {
+namespace Location {
+class NlpDisconnectWindowTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+    int SimulateConnectCount(NlpDisconnectWindow& window, const std::vector<int64_t>& gaps, int64_t durationMs);
+};
+} // namespace Location
+} // namespace OHOS
+#endif // FEATURE_NETWORK_SUPPORT
+#endif // NLP_DISCONNECT_WINDOW_TEST_H
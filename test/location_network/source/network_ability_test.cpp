@@ -20,6 +20,8 @@
 #include "network_ability.h"
 #undef private
 #include <cstdlib>
+#include <set>
+#include <thread>
 #include "accesstoken_kit.h"
 #include "if_system_ability_manager.h"
 #include "ipc_skeleton.h"
@@ -31,6 +33,7 @@
 
 #include "common_utils.h"
 #include "constant_definition.h"
+#include "local_location_reporter.h"
 #include "location.h"
 #include "location_dumper.h"
 #include "location_log.h"
@@ -66,6 +69,25 @@ const int32_t LOCATION_PERM_NUM = 5;
 const std::string ARGS_HELP = "-h";
 const std::string UNLOAD_NETWORK_TASK = "network_sa_unload";
 const int32_t WAIT_EVENT_TIME = 1;
+const int NLP_BURST_THREAD_NUM = 4;
+const int NLP_BURST_REQUEST_NUM_PER_THREAD = 10;
+const int NLP_BURST_GROUP_NUM = 2;
+
+static std::unique_ptr<WorkRecord> CreateNlpWorkRecord(int index, int nlpRequestType)
+{
+    std::unique_ptr<WorkRecord> workRecord = std::make_unique<WorkRecord>();
+    std::shared_ptr<Request> request = std::make_shared<Request>();
+    std::unique_ptr<RequestConfig> requestConfig = std::make_unique<RequestConfig>();
+    requestConfig->SetTimeInterval(1);
+    request->SetUid(index);
+    request->SetPid(index);
+    request->SetPackageName("nameForTest" + std::to_string(index));
+    request->SetRequestConfig(*requestConfig);
+    request->SetUuid("nlpBurst" + std::to_string(index));
+    request->SetNlpRequestType(nlpRequestType);
+    workRecord->Add(request);
+    return workRecord;
+}
 void NetworkAbilityTest::SetUp()
 {
     /*
@@ -759,6 +781,138 @@ HWTEST_F(NetworkAbilityTest, RemoveNetworkLocation002, TestSize.Level1)
     LBSLOGI(NETWORK, "[NetworkAbilityTest] RemoveNetworkLocation002 end");
 }
 
+HWTEST_F(NetworkAbilityTest, NlpRequestMultiplex001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "NetworkAbilityTest, NlpRequestMultiplex001, TestSize.Level1";
+    LBSLOGI(NETWORK, "[NetworkAbilityTest] NlpRequestMultiplex001 begin");
+    sptr<MockIRemoteObject> nlpServiceProxy =
+        sptr<MockIRemoteObject>(new (std::nothrow) MockIRemoteObject());
+    ASSERT_NE(nullptr, nlpServiceProxy);
+    ability_->nlpServiceProxy_ = nlpServiceProxy;
+    // a burst of requests with two nlp request types reaches the nlp service as two requests
+    int nlpRequestNum = 0;
+    EXPECT_CALL(*nlpServiceProxy, SendRequest(REQUEST_NETWORK_LOCATION, _, _, _))
+        .WillRepeatedly(DoAll(InvokeWithoutArgs([&nlpRequestNum]() { nlpRequestNum++; }), Return(ERR_OK)));
+    EXPECT_CALL(*nlpServiceProxy, SendRequest(REMOVE_NETWORK_LOCATION, _, _, _))
+        .Times(NLP_BURST_GROUP_NUM).WillRepeatedly(Return(ERR_OK));
+    int requestNum = NLP_BURST_THREAD_NUM * NLP_BURST_REQUEST_NUM_PER_THREAD;
+    std::vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < NLP_BURST_THREAD_NUM; threadIndex++) {
+        threads.emplace_back([this, threadIndex]() {
+            for (int i = 0; i < NLP_BURST_REQUEST_NUM_PER_THREAD; i++) {
+                int index = threadIndex * NLP_BURST_REQUEST_NUM_PER_THREAD + i;
+                auto workRecord = CreateNlpWorkRecord(index, index % NLP_BURST_GROUP_NUM);
+                EXPECT_EQ(true, ability_->RequestNetworkLocation(*workRecord));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(NLP_BURST_GROUP_NUM, ability_->nlpRequestGroups_.size());
+    EXPECT_EQ(requestNum, ability_->nlpRequestGroupKeys_.size());
+    EXPECT_EQ(NLP_BURST_GROUP_NUM, nlpRequestNum);
+
+    // requesting again or removing a part of the requests does not reach the nlp service,
+    // except when the request the group is named after leaves and the name is handed over
+    auto workRecord = CreateNlpWorkRecord(0, 0);
+    EXPECT_EQ(true, ability_->RequestNetworkLocation(*workRecord));
+    int handOverNum = 0;
+    for (int index = 0; index < requestNum - NLP_BURST_GROUP_NUM; index++) {
+        workRecord = CreateNlpWorkRecord(index, index % NLP_BURST_GROUP_NUM);
+        auto& group = ability_->nlpRequestGroups_[ability_->nlpRequestGroupKeys_[workRecord->GetUuid(0)]];
+        if (group.name == workRecord->GetName(0)) {
+            handOverNum++;
+        }
+        EXPECT_EQ(true, ability_->RemoveNetworkLocation(*workRecord));
+    }
+    EXPECT_EQ(NLP_BURST_GROUP_NUM, ability_->nlpRequestGroups_.size());
+    EXPECT_EQ(NLP_BURST_GROUP_NUM + handOverNum, nlpRequestNum);
+    // the last request of every group removes the request of the group
+    for (int index = requestNum - NLP_BURST_GROUP_NUM; index < requestNum; index++) {
+        workRecord = CreateNlpWorkRecord(index, index % NLP_BURST_GROUP_NUM);
+        EXPECT_EQ(true, ability_->RemoveNetworkLocation(*workRecord));
+    }
+    EXPECT_EQ(0, ability_->nlpRequestGroups_.size());
+    EXPECT_EQ(0, ability_->nlpRequestGroupKeys_.size());
+    ability_->nlpServiceProxy_ = nullptr;
+    LBSLOGI(NETWORK, "[NetworkAbilityTest] NlpRequestMultiplex001 end");
+}
+
+HWTEST_F(NetworkAbilityTest, NlpRequestGroupMove001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "NetworkAbilityTest, NlpRequestGroupMove001, TestSize.Level1";
+    LBSLOGI(NETWORK, "[NetworkAbilityTest] NlpRequestGroupMove001 begin");
+    sptr<MockIRemoteObject> nlpServiceProxy =
+        sptr<MockIRemoteObject>(new (std::nothrow) MockIRemoteObject());
+    ASSERT_NE(nullptr, nlpServiceProxy);
+    ability_->nlpServiceProxy_ = nlpServiceProxy;
+    // group 0 is requested for request 0, handed over to request 1, then removed, group 1 is requested once
+    EXPECT_CALL(*nlpServiceProxy, SendRequest(REQUEST_NETWORK_LOCATION, _, _, _))
+        .Times(3).WillRepeatedly(Return(ERR_OK));
+    EXPECT_CALL(*nlpServiceProxy, SendRequest(REMOVE_NETWORK_LOCATION, _, _, _))
+        .Times(1).WillRepeatedly(Return(ERR_OK));
+    EXPECT_EQ(true, ability_->RequestNetworkLocation(*CreateNlpWorkRecord(0, 0)));
+    EXPECT_EQ(true, ability_->RequestNetworkLocation(*CreateNlpWorkRecord(1, 0)));
+
+    // the request the group is named after moves to another nlp request type
+    auto movedRecord = CreateNlpWorkRecord(0, 1);
+    EXPECT_EQ(true, ability_->RequestNetworkLocation(*movedRecord));
+    NlpRequestGroupKey oldKey = ability_->nlpRequestGroupKeys_[CreateNlpWorkRecord(1, 0)->GetUuid(0)];
+    EXPECT_EQ(CreateNlpWorkRecord(1, 0)->GetName(0), ability_->nlpRequestGroups_[oldKey].name);
+    EXPECT_EQ(2, ability_->nlpRequestGroups_.size());
+
+    // the last request of group 0 moves too, group 0 is dropped
+    EXPECT_EQ(true, ability_->RequestNetworkLocation(*CreateNlpWorkRecord(1, 1)));
+    EXPECT_EQ(1, ability_->nlpRequestGroups_.size());
+    EXPECT_EQ(0, ability_->nlpRequestGroups_.count(oldKey));
+    ability_->ClearNlpRequestGroups();
+    ability_->nlpServiceProxy_ = nullptr;
+    LBSLOGI(NETWORK, "[NetworkAbilityTest] NlpRequestGroupMove001 end");
+}
+
+HWTEST_F(NetworkAbilityTest, NlpRequestGroupReport001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "NetworkAbilityTest, NlpRequestGroupReport001, TestSize.Level1";
+    LBSLOGI(NETWORK, "[NetworkAbilityTest] NlpRequestGroupReport001 begin");
+    sptr<MockIRemoteObject> nlpServiceProxy =
+        sptr<MockIRemoteObject>(new (std::nothrow) MockIRemoteObject());
+    ASSERT_NE(nullptr, nlpServiceProxy);
+    ability_->nlpServiceProxy_ = nlpServiceProxy;
+    EXPECT_CALL(*nlpServiceProxy, SendRequest(REQUEST_NETWORK_LOCATION, _, _, _))
+        .WillRepeatedly(Return(ERR_OK));
+    std::set<std::string> memberUuids;
+    for (int index = 0; index < NLP_BURST_REQUEST_NUM_PER_THREAD; index++) {
+        auto workRecord = CreateNlpWorkRecord(index, 0);
+        EXPECT_EQ(true, ability_->RequestNetworkLocation(*workRecord));
+        memberUuids.insert(workRecord->GetUuid(0));
+    }
+    ASSERT_EQ(1, ability_->nlpRequestGroups_.size());
+    std::string groupUuid = ability_->nlpRequestGroups_.begin()->second.uuid;
+
+    std::vector<std::string> reportedUuids;
+    LocalLocationReporter::GetInstance()->RegisterReporter(
+        [&reportedUuids](const std::string& abilityName, const std::shared_ptr<Location>& location) {
+            EXPECT_EQ(NETWORK_ABILITY, abilityName);
+            reportedUuids.push_back(location->GetUuid());
+            return ERRCODE_SUCCESS;
+        });
+    // the nlp service reports the fix under the group uuid, each request gets it under its own uuid
+    auto location = std::make_shared<Location>();
+    location->SetUuid(groupUuid);
+    ability_->ReportNlpLocation(location);
+    LocalLocationReporter::GetInstance()->UnregisterReporter();
+    EXPECT_EQ(memberUuids.size(), reportedUuids.size());
+    EXPECT_EQ(memberUuids, std::set<std::string>(reportedUuids.begin(), reportedUuids.end()));
+    EXPECT_EQ(groupUuid, location->GetUuid());
+    ability_->ClearNlpRequestGroups();
+    ability_->nlpServiceProxy_ = nullptr;
+    LBSLOGI(NETWORK, "[NetworkAbilityTest] NlpRequestGroupReport001 end");
+}
+
 HWTEST_F(NetworkAbilityTest, RegisterNlpServiceDeathRecipient002, TestSize.Level1)
 {
     GTEST_LOG_(INFO)
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef FEATURE_NETWORK_SUPPORT
+#include "nlp_disconnect_window_test.h"
+
+#include "location_log.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Location {
+const int64_t SIMULATION_START_TIME_MS = 1000;
+const int64_t REQUEST_DURATION_MS = 2000;
+const int64_t DEFAULT_MIN_WINDOW_MS = 5000;
+const int64_t DEFAULT_MAX_WINDOW_MS = 60000;
+const int PERIODIC_ROUNDS = 10;
+const int SPARSE_REQUEST_NUM = 10;
+const int64_t SPARSE_GAP_MS = 120 * 1000;
+const int64_t SHIFTED_GAP_MS = 30 * 1000;
+const int SHIFTED_REQUEST_NUM = 40;
+
+void NlpDisconnectWindowTest::SetUp()
+{
+}
+
+void NlpDisconnectWindowTest::TearDown()
+{
+}
+
+/*
+ * Replays one request per gap on top of a first one, each lasting durationMs. The service is connected again
+ * whenever a request arrives after the previous one ended plus the disconnect window.
+ */
+int NlpDisconnectWindowTest::SimulateConnectCount(NlpDisconnectWindow& window,
+    const std::vector<int64_t>& gaps, int64_t durationMs)
+{
+    int connectCount = 0;
+    bool isConnected = false;
+    int64_t arrivalTime = SIMULATION_START_TIME_MS;
+    int64_t disconnectTime = 0;
+    for (size_t i = 0; i <= gaps.size(); i++) {
+        if (i > 0) {
+            arrivalTime += gaps[i - 1];
+        }
+        window.OnRequestArrival(arrivalTime);
+        if (!isConnected || arrivalTime >= disconnectTime) {
+            connectCount++;
+            isConnected = true;
+        }
+        disconnectTime = arrivalTime + durationMs + window.GetWindowMs();
+    }
+    return connectCount;
+}
+
+HWTEST_F(NlpDisconnectWindowTest, PeriodicRequests001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "NlpDisconnectWindowTest, PeriodicRequests001, TestSize.Level1";
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] PeriodicRequests001 begin");
+    // single location requests every 20s to 40s
+    std::vector<int64_t> pattern = {20000, 25000, 30000, 35000, 40000};
+    std::vector<int64_t> gaps;
+    for (int i = 0; i < PERIODIC_ROUNDS; i++) {
+        gaps.insert(gaps.end(), pattern.begin(), pattern.end());
+    }
+    NlpDisconnectWindow fixedWindow(DEFAULT_MIN_WINDOW_MS, DEFAULT_MIN_WINDOW_MS);
+    EXPECT_EQ(static_cast<int>(gaps.size()) + 1, SimulateConnectCount(fixedWindow, gaps, REQUEST_DURATION_MS));
+    EXPECT_EQ(DEFAULT_MIN_WINDOW_MS, fixedWindow.GetWindowMs());
+
+    NlpDisconnectWindow adaptiveWindow(DEFAULT_MIN_WINDOW_MS, DEFAULT_MAX_WINDOW_MS);
+    // connected again only while the first gaps are collected
+    EXPECT_EQ(6, SimulateConnectCount(adaptiveWindow, gaps, REQUEST_DURATION_MS));
+    EXPECT_EQ(41000, adaptiveWindow.GetWindowMs());
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] PeriodicRequests001 end");
+}
+
+HWTEST_F(NlpDisconnectWindowTest, SparseRequests001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "NlpDisconnectWindowTest, SparseRequests001, TestSize.Level1";
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] SparseRequests001 begin");
+    std::vector<int64_t> gaps(SPARSE_REQUEST_NUM, SPARSE_GAP_MS);
+    NlpDisconnectWindow window(DEFAULT_MIN_WINDOW_MS, DEFAULT_MAX_WINDOW_MS);
+    // gaps beyond the max bound can not be covered, the service is released early
+    EXPECT_EQ(SPARSE_REQUEST_NUM + 1, SimulateConnectCount(window, gaps, REQUEST_DURATION_MS));
+    EXPECT_EQ(DEFAULT_MIN_WINDOW_MS, window.GetWindowMs());
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] SparseRequests001 end");
+}
+
+HWTEST_F(NlpDisconnectWindowTest, PatternShift001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "NlpDisconnectWindowTest, PatternShift001, TestSize.Level1";
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] PatternShift001 begin");
+    std::vector<int64_t> gaps(SPARSE_REQUEST_NUM, SPARSE_GAP_MS);
+    gaps.insert(gaps.end(), SHIFTED_REQUEST_NUM, SHIFTED_GAP_MS);
+    NlpDisconnectWindow window(DEFAULT_MIN_WINDOW_MS, DEFAULT_MAX_WINDOW_MS);
+    int connectCount = SimulateConnectCount(window, gaps, REQUEST_DURATION_MS);
+    // the sparse gaps age out of the recent gaps, the periodic requests then keep the service connected
+    EXPECT_GT(connectCount, SPARSE_REQUEST_NUM + 1);
+    EXPECT_LT(connectCount, SPARSE_REQUEST_NUM + 1 + SHIFTED_REQUEST_NUM);
+    EXPECT_EQ(31000, window.GetWindowMs());
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] PatternShift001 end");
+}
+
+HWTEST_F(NlpDisconnectWindowTest, WindowBounds001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "NlpDisconnectWindowTest, WindowBounds001, TestSize.Level1";
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] WindowBounds001 begin");
+    std::vector<int64_t> shortGaps(SPARSE_REQUEST_NUM, 500);
+    NlpDisconnectWindow window(DEFAULT_MIN_WINDOW_MS, DEFAULT_MAX_WINDOW_MS);
+    SimulateConnectCount(window, shortGaps, REQUEST_DURATION_MS);
+    EXPECT_EQ(DEFAULT_MIN_WINDOW_MS, window.GetWindowMs());
+
+    std::vector<int64_t> gaps(SPARSE_REQUEST_NUM, 15000);
+    NlpDisconnectWindow boundedWindow(DEFAULT_MIN_WINDOW_MS, 20000);
+    SimulateConnectCount(boundedWindow, gaps, REQUEST_DURATION_MS);
+    EXPECT_EQ(16000, boundedWindow.GetWindowMs());
+
+    // a max bound below the min bound is raised to it
+    NlpDisconnectWindow invalidWindow(10000, 3000);
+    SimulateConnectCount(invalidWindow, shortGaps, REQUEST_DURATION_MS);
+    EXPECT_EQ(10000, invalidWindow.GetWindowMs());
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] WindowBounds001 end");
+}
+
+HWTEST_F(NlpDisconnectWindowTest, DumpInfo001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO)
+        << "NlpDisconnectWindowTest, DumpInfo001, TestSize.Level1";
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] DumpInfo001 begin");
+    NlpDisconnectWindow window(DEFAULT_MIN_WINDOW_MS, DEFAULT_MAX_WINDOW_MS);
+    window.OnConnected(100);
+    window.OnConnected(300);
+    window.OnDisconnected(10);
+    std::string result;
+    window.DumpInfo(result);
+    EXPECT_NE(std::string::npos, result.find("NLP connect count: 2, avg cost: 200ms, max cost: 300ms"));
+    EXPECT_NE(std::string::npos, result.find("NLP disconnect count: 1, avg cost: 10ms, max cost: 10ms"));
+    EXPECT_NE(std::string::npos, result.find("NLP disconnect window: 5000ms"));
+    LBSLOGI(NETWORK, "[NlpDisconnectWindowTest] DumpInfo001 end");
+}
+} // namespace Location
+} // namespace OHOS
+#endif // FEATURE_NETWORK_SUPPORT